@@ -6,7 +6,6 @@
  */
 
 #include <stdio.h>
-#include <ctype.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -27,6 +26,49 @@
 #define PRINTING_TYPE unsigned long
 #endif
 
+// Vector instructions used to check and convert long strings
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define SSE2_CONVERSION
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define AVX2_CONVERSION
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define NEON_CONVERSION
+#endif
+
+// Bit counting instructions; builtins become popcnt, lzcnt and tzcnt when the target processor has them
+#if defined(__GNUC__) || defined(__clang__)
+#define BUILTIN_BIT_COUNTING
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define MSVC_BIT_COUNTING
+#endif
+
+// Atomic operations publishing shared caches of powers, so that conversions may run in many threads
+#if defined(__GNUC__) || defined(__clang__)
+#define BUILTIN_ATOMICS
+#elif defined(_MSC_VER)
+#define MSVC_ATOMICS
+#endif
+
+// Threads running batch operations; without atomics all items are computed in the calling thread
+#if defined(BUILTIN_ATOMICS) || defined(MSVC_ATOMICS)
+#if defined(_WIN32)
+#include <windows.h>
+#define WINDOWS_THREADS
+#elif defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#include <unistd.h>
+#define POSIX_THREADS
+#endif
+#endif
+
 #define SUCCESS 0
 #define FAILURE -1
 
@@ -42,6 +84,84 @@
 #define BIGINT_LITTLE_ENDIAN -1
 #define BIGINT_BIG_ENDIAN 1
 
+// Operands shorter than this number of limbs are multiplied by schoolbook method
+#define KARATSUBA_THRESHOLD 32
+
+// Number of small factors multiplied one by one in leaves of a product tree
+#define PRODUCT_TREE_LEAF 16
+
+// Binomial coefficients are computed as a product of k factors divided by k! up to this k;
+// primes up to n are sieved at once only if k is greater than n divided by the fraction
+#define BINOMIAL_PRODUCT_THRESHOLD 256
+#define BINOMIAL_SIEVE_FRACTION 4
+#define BINOMIAL_SIEVE_BLOCK 65536
+
+// Strings longer than this number of digits are converted by splitting them in halves
+#define RADIX_CONVERSION_THRESHOLD 1000
+
+// Numbers shorter than this number of limbs are converted to strings by repeated division by one limb
+#define RADIX_OUTPUT_THRESHOLD 30
+
+// Largest base of numeral system; digits are 0-9, A-Z and a-z
+#define MAX_RADIX 62
+
+// Reciprocals of numbers shorter than this number of limbs are computed by long division
+#define RECIPROCAL_THRESHOLD 64
+
+// Kinds of moduli; the special ones are 2^k - c and 2^k + c with c fitting in one limb
+#define GENERAL_MODULUS 0
+#define MINUS_FORM_MODULUS 1
+#define PLUS_FORM_MODULUS 2
+
+// Special forms are used only for moduli longer than this number of bits
+#define SPECIAL_MODULUS_MIN_BITS 64
+
+// Number of exponent bits processed at once by bigint_powm()
+#define POWM_WINDOW 4
+
+// From this number of bases bigint_powm_multi() collects them in buckets instead of precomputing powers
+#define POWM_BUCKETS_THRESHOLD 128
+
+// Arrays of serialized numbers start with magic bytes, version and count of numbers
+#define SERIALIZATION_MAGIC "BINT"
+#define SERIALIZATION_VERSION 1
+#define ARRAY_HEADER_SIZE 16
+
+// States of streaming parser
+#define PARSER_START 0
+#define PARSER_DIGITS 1
+#define PARSER_END 2
+#define PARSER_ERROR 3
+
+// Size of buffer used by bigint_read() to read a stream
+#define READ_BUFFER_SIZE 65536
+
+// Size of buffer in which digits are collected before they are written
+#define WRITE_BUFFER_SIZE 65536
+
+// Bitwise operations on two's complement
+#define BITWISE_AND 0
+#define BITWISE_IOR 1
+#define BITWISE_XOR 2
+#define BITWISE_ANDNOT 3
+
+// Changes of single bit
+#define BIT_SET 0
+#define BIT_CLEAR 1
+#define BIT_FLIP 2
+
+// Batches cheaper than this number of multiplied pairs of limbs are computed in one thread
+#define BATCH_PARALLEL_COST 4096
+
+// Ends of deques of batch items have 32 bits, so longer batches are run in rounds of this size
+#define BATCH_ROUND_SIZE 0xffffffffu
+
+// Halves of numbers longer than this number of limbs or chunks of digits are converted in separate threads
+#define PARALLEL_CONVERSION_THRESHOLD 8192
+
+// Size of cache line; every deque of batch items has its own line, so that workers do not slow each other down
+#define CACHE_LINE_SIZE 64
+
 // Check operating system
 #if defined(_WIN32) || defined(WIN32) || defined(__CYGWIN__) || defined(__MINGW32__) || defined(__BORLANDC__)
 #define BIGINT_OS "Windows"
@@ -110,13 +230,113 @@
 	(A)->length = 0;               \
 	(A)->sign = 0
 
+// Modulus prepared for many reductions
+struct bigint_modulus
+{
+	uint32_t *limbs;
+	size_t length;
+	int form;
+	size_t k;
+	uint32_t c;
+	uint32_t *scratch;
+	size_t scratch_length;
+	uint32_t *product;
+};
+
+// Array of factors that grows as they are found
+struct factor_list
+{
+	uint32_t *factors;
+	size_t count;
+	size_t capacity;
+};
+
+// Cached power or reciprocal; length is kept with limbs, so an entry is published with one pointer
+struct radix_cache_entry
+{
+	size_t length;
+	uint32_t limbs[];
+};
+
+// Digits collected before they are passed to the writer
+struct radix_output
+{
+	bigint_writer writer;
+	void *context;
+	size_t position;
+	char buffer[WRITE_BUFFER_SIZE];
+};
+
+// Item of batch with estimated cost of computing it
+struct batch_item
+{
+	double cost;
+	size_t index;
+};
+
+// Range of positions left in deque of one worker: the beginning in high 32 bits and the end in low 32 bits
+struct batch_queue
+{
+	uint64_t range;
+	uint8_t padding[CACHE_LINE_SIZE - sizeof(uint64_t)];
+};
+
+// Batch operation shared by all workers
+struct batch_work
+{
+	int (*operation)(struct batch_work *work, size_t index);
+	bigint *results;
+	bigint *operands[3];
+	struct batch_item *items;
+	size_t start;
+	size_t workers;
+	struct batch_queue *queues;
+	int failed;
+	int error;
+};
+
+struct batch_worker
+{
+	struct batch_work *work;
+	size_t id;
+	int started;
+#if defined(POSIX_THREADS)
+	pthread_t thread;
+#elif defined(WINDOWS_THREADS)
+	HANDLE thread;
+#endif
+};
+
+// Half of number converted by another thread; limbs are input of output conversion and result of input conversion
+struct conversion_task
+{
+	int (*function)(struct conversion_task *task);
+	uint32_t *chunks;
+	size_t count;
+	int radix;
+	uint32_t *limbs;
+	size_t length;
+	char *buffer;
+	size_t digits;
+	int threads;
+	int status;
+	int error;
+	int started;
+#if defined(POSIX_THREADS)
+	pthread_t thread;
+#elif defined(WINDOWS_THREADS)
+	HANDLE thread;
+#endif
+};
+
 static int bigint_release_basic(bigint number);
 static int bigint_release_segments(bigint number);
 static int add_segments_beginning(bigint number, size_t count);
 static uint32_t *copy_to_chain(bigint number);
 static size_t bit_len(uint32_t number);
+static unsigned int popcount_32(uint32_t number);
+static unsigned int trailing_zeros(uint32_t number);
 static int check_endian();
-static int print_bits(uint32_t number);
 static uint8_t get_n_bit(uint32_t *chain, size_t length, size_t number);
 static size_t chain_length(uint32_t *chain, size_t max_count);
 static int set_n_bit_to_1(uint32_t *chain, size_t length, size_t number);
@@ -125,6 +345,7 @@ static int bigint_increment_basic(bigint number);
 static int bigint_subtract_basic(bigint difference, bigint minuend, bigint subtrahend);
 static int bigint_decrement_basic(bigint number);
 static int bigint_multiply_basic(bigint product, bigint element1, bigint element2);
+static int addmul(bigint result, bigint number1, bigint number2, uint8_t subtract);
 static int bigint_compare_absolute(bigint number1, bigint number2);
 static bigint bigint_create_empty_segments(size_t count);
 static int add_segments(bigint number, size_t count);
@@ -132,27 +353,136 @@ static int reset(bigint number);
 static uint8_t check_sign(char **number, size_t *length);
 static bigint_base check_base(char **number, size_t *length);
 static int check_syntax(char **number, size_t length, bigint_base base);
-static uint32_t save_binary_segment(char *number);
-static int save_binary(bigint return_number, char *number, size_t length);
-static char *convert_to_binary(char *number, size_t length);
-static int get_parity(char *number, size_t length);
-static void divide_one_digit(char *digit);
-static void divide_digits(char *number, size_t length);
-static int is_zero(char *number, size_t length);
-static int save_decimal(bigint return_number, char *number, size_t length);
-static int print_bits_first_element(uint32_t num);
-static uint64_t divide(uint32_t *divident, uint32_t *quotient, size_t count);
-static int print_decimal(bigint number);
-static int bigint_shift_left_basic(bigint number);
-static int bigint_shift_right_basic(bigint number);
+static uint32_t digit_value(char digit, int radix);
+static int check_digits(char *number, size_t length, int radix);
+static uint32_t pack_digits(char *number, size_t length, unsigned int bits);
+#ifdef SSE2_CONVERSION
+static void pack_hex_sse2(char *number, uint32_t *limbs);
+#endif
+static int save_power_of_two(bigint return_number, char *number, size_t length, unsigned int bits);
+static uint32_t radix_chunk_base(int radix, size_t *digits);
+static uint32_t radix_chunk(char *number, size_t length, int radix);
+static uint32_t *radix_power(int radix, size_t k, size_t *length);
+static int chunks_to_limbs(uint32_t *chunks, size_t count, int radix, uint32_t *limbs, size_t *limbs_length, int threads);
+static int radix_to_limbs(char *number, size_t length, int radix, uint32_t *limbs, size_t *limbs_length);
+static int save_radix(bigint return_number, char *number, size_t length, int radix);
+static bigint create_from_digits(char *number, size_t length, uint8_t sign, int radix);
+static const char *digit_characters(int radix);
+static void write_radix_chunk(char *buffer, uint32_t chunk, int radix, size_t digits);
+static uint32_t *radix_reciprocal(int radix, size_t k, size_t *length);
+static struct radix_cache_entry *cache_load(struct radix_cache_entry **slot);
+static struct radix_cache_entry *cache_publish(struct radix_cache_entry **slot, struct radix_cache_entry *entry);
+static size_t radix_split(uint32_t *limbs, size_t length, int radix, size_t digits);
+static int limbs_to_radix(uint32_t *limbs, size_t length, int radix, char *buffer, size_t digits, size_t *written, int threads);
+static int output_flush(struct radix_output *output);
+static int output_append(struct radix_output *output, const char *data, size_t count);
+static int limbs_stream_radix(uint32_t *limbs, size_t length, int radix, size_t digits, struct radix_output *output);
+static int stream_power_of_two_digits(bigint number, unsigned int bits, const char *characters, struct radix_output *output);
+static int stream_string(bigint_writer writer, void *context, int radix, const char *prefix, bigint number);
+static int write_file(const char *data, size_t length, void *context);
+static size_t write_power_of_two_digits(bigint number, char *buffer, unsigned int bits, const char *characters);
+static size_t digits_bound(bigint number, int radix);
+static size_t write_string(char *buffer, size_t capacity, int radix, const char *prefix, bigint number);
 static int bigint_add_sign(bigint sum, bigint summand1, bigint summand2);
 static int leave_one_segment(bigint number);
 static uint32_t *chain_alignment(bigint number, size_t length);
 static int greater_or_eq(uint32_t *array1, uint32_t *array2, size_t length);
+static uint32_t *copy_to_limbs(bigint number, size_t *length);
+static int save_limbs(bigint number, uint32_t *limbs, size_t length, uint8_t sign);
+static int resize_segments(bigint number, size_t length);
+static size_t limbs_normalize(uint32_t *limbs, size_t length);
+static uint32_t limbs_add(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static uint32_t limbs_subtract(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static uint32_t limbs_multiply_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor);
+static uint32_t limbs_addmul_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor);
+static uint32_t limbs_submul_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor);
+static uint32_t limbs_shift_left(uint32_t *result, uint32_t *limbs, size_t length, unsigned int bits);
+static uint32_t limbs_shift_right(uint32_t *result, uint32_t *limbs, size_t length, unsigned int bits);
+static uint32_t limb_inverse(uint32_t limb);
+static void limbs_multiply_basecase(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static int limbs_karatsuba(uint32_t *result, uint32_t *limbs1, uint32_t *limbs2, size_t length);
+static int limbs_multiply(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static uint32_t *limbs_product(uint32_t *factors, size_t count, size_t *length);
+static uint32_t *sieve_primes(uint32_t limit, size_t *count);
+static uint32_t *odd_factorial(uint32_t n, uint32_t *primes, size_t primes_count, size_t *length);
+static int push_factor(struct factor_list *list, uint32_t factor);
+static uint32_t square_root(uint32_t n);
+static int binomial_product(bigint result, uint32_t n, uint32_t k);
+static int binomial_kummer(bigint result, uint32_t n, uint32_t k);
+static int binomial_large_primes(struct factor_list *list, uint64_t low, uint64_t high, uint32_t n, uint32_t k, uint32_t *primes, size_t primes_count);
+static int binomial_split(bigint result, uint32_t n, uint32_t k);
+static uint32_t *fibonacci_pair(unsigned long n, uint32_t **fn, uint32_t **fn1, size_t *length);
+static int limbs_compare(uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static uint32_t limbs_divide_1(uint32_t *quotient, uint32_t *limbs, size_t length, uint32_t divisor);
+static int limbs_divide(uint32_t *quotient, uint32_t *remainder, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2);
+static int limbs_reciprocal(uint32_t *result, size_t *result_length, uint32_t *limbs, size_t length);
+static int limbs_divide_reciprocal(uint32_t *quotient, size_t *quotient_length, uint32_t *remainder, size_t *remainder_length, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2, uint32_t *reciprocal, size_t reciprocal_length);
+static int prepare_modulus(struct bigint_modulus *modulus, bigint number);
+static void release_modulus(struct bigint_modulus *modulus);
+static int reserve_scratch(struct bigint_modulus *modulus, size_t length);
+static int reduce_special(struct bigint_modulus *modulus, uint32_t *limbs, size_t *length);
+static int reduce(struct bigint_modulus *modulus, uint32_t *limbs, size_t *length);
+static int multiply_modulo(struct bigint_modulus *modulus, uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2, size_t *length);
+static uint32_t *copy_residue(struct bigint_modulus *modulus, bigint number, size_t *length);
+static uint32_t limbs_window(uint32_t *limbs, size_t length, size_t bit, unsigned int width);
+static int limbs_invert(uint32_t *result, size_t *length, uint32_t *limbs, size_t len, struct bigint_modulus *modulus);
+static int powm_straus(struct bigint_modulus *modulus, uint32_t *result, size_t *length, uint32_t **bases, size_t *base_lengths, uint32_t **exponents, size_t *exponent_lengths, size_t count, size_t bits);
+static int powm_buckets(struct bigint_modulus *modulus, uint32_t *result, size_t *length, uint32_t **bases, size_t *base_lengths, uint32_t **exponents, size_t *exponent_lengths, size_t count, size_t bits);
+static size_t raw_byte_offset(size_t index, size_t count, int order, size_t size, int endian);
+static size_t varint_size(uint64_t value);
+static size_t write_varint(uint8_t *buffer, uint64_t value);
+static size_t read_varint(const uint8_t *buffer, size_t length, uint64_t *value);
+static void write_u64(uint8_t *buffer, uint64_t value);
+static uint64_t read_u64(const uint8_t *buffer);
+static const uint8_t *array_record(const void *data, size_t size, size_t index, size_t *length);
+static int parser_push_chunk(bigint_parser parser);
+static int parser_power_of_two(bigint_parser parser, bigint result);
+static int parser_radix(bigint_parser parser, bigint result);
+static int get_u64(bigint number, uint64_t *magnitude);
+static int set_u64(bigint number, uint64_t magnitude, uint8_t sign);
+static uint8_t limbs_bitwise(uint32_t *result, uint32_t *limbs1, size_t length1, uint8_t sign1, uint32_t *limbs2, size_t length2, uint8_t sign2, int operation);
+static int bigint_bitwise(bigint result, bigint number1, bigint number2, int operation);
+static bigint_node *node_at(bigint number, size_t index);
+static uint32_t complement_carry(bigint number, size_t index);
+static int magnitude_step(bigint number, int increase);
+static int change_bit(bigint number, size_t index, int operation);
+static size_t scan_bit(bigint number, size_t start, int bit);
+static int compare_u64(bigint number, uint64_t magnitude);
+static int load_int(int *value);
+static void store_int(int *value, int desired);
+static int exchange_int(int *value, int expected, int desired);
+static int queue_take(struct batch_queue *queue, int front, size_t *position);
+static void batch_worker(struct batch_worker *worker);
+#if defined(POSIX_THREADS)
+static void *batch_thread(void *worker);
+#elif defined(WINDOWS_THREADS)
+static DWORD WINAPI batch_thread(LPVOID worker);
+#endif
+static int compare_batch_items(const void *item1, const void *item2);
+static int batch_run(struct batch_work *work, size_t count, double (*cost)(struct batch_work *work, size_t index));
+static int check_batch(bigint *numbers, size_t count);
+static double cost_add(struct batch_work *work, size_t index);
+static double cost_multiply(struct batch_work *work, size_t index);
+static double cost_mod(struct batch_work *work, size_t index);
+static double cost_powm(struct batch_work *work, size_t index);
+static int batch_add(struct batch_work *work, size_t index);
+static int batch_multiply(struct batch_work *work, size_t index);
+static int batch_mod(struct batch_work *work, size_t index);
+static int batch_powm(struct batch_work *work, size_t index);
+static int conversion_threads(size_t length);
+static void task_start(struct conversion_task *task, int parallel);
+static int task_finish(struct conversion_task *task);
+#if defined(POSIX_THREADS)
+static void *conversion_thread(void *task);
+#elif defined(WINDOWS_THREADS)
+static DWORD WINAPI conversion_thread(LPVOID task);
+#endif
+static int task_chunks_to_limbs(struct conversion_task *task);
+static int task_limbs_to_radix(struct conversion_task *task);
 
-bigint_error_code bigint_errno = ALL_GOOD_IN_THE_HOOD;
+BIGINT_THREAD_LOCAL bigint_error_code bigint_errno = ALL_GOOD_IN_THE_HOOD;
 
-char *error_messages[] = {
+const char *const error_messages[] = {
 	"everything is all right",
 	"bigint_create() function was given an incorrect string",
 	"failed to allocate memory on the heap",
@@ -160,7 +490,41 @@ char *error_messages[] = {
 	"bigint variable is too large to be converted to integer",
 	"division by zero",
 	"cannot convert to bigint integer with number of bytes indivisible by four",
-	"unexpected value in bigint data structure"};
+	"unexpected value in bigint data structure",
+	"number is not invertible modulo given modulus",
+	"buffer is too small to hold the string",
+	"serialized data are incorrect or truncated",
+	"failed to write the output"};
+
+// Number of threads used by batch operations; 0 means one thread for every processor
+static int thread_count = 0;
+
+// Number of processors, read from the system once; 0 until then
+#if defined(POSIX_THREADS) || defined(WINDOWS_THREADS)
+static int processor_count = 0;
+#endif
+
+// Values of digits used in strings; both cases of letters have the same value and 0xff marks characters that are not digits
+static const uint8_t digit_values[256] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+	25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff};
+
+// Bases of numeral systems from enum bigint_base
+static const int base_radixes[] = {2, 10, 16};
 
 int bigint_info()
 {
@@ -256,15 +620,96 @@ int check_syntax(char **number, size_t length, bigint_base base)
 		return FAILURE;
 	}
 
-	// Choose proper charset according to the base
-	char *charsets[] = {"01", "0123456789", "0123456789ABCDEF"};
-	char *charset = charsets[base];
+	return check_digits(*number, length, base_radixes[base]);
+}
+
+// Value of a digit in given base; above base 36 lowercase letters follow uppercase ones
+uint32_t digit_value(char digit, int radix)
+{
+	uint32_t value = digit_values[(unsigned char)digit];
+	if (radix > 36 && digit >= 'a' && digit <= 'z')
+	{
+		value += 26;
+	}
+	return value;
+}
 
-	// Check each digit in the number
+// Check that all characters are digits of given base; vector instructions check 16 or 32 characters at once
+int check_digits(char *number, size_t length, int radix)
+{
 	size_t i = 0;
-	for (i = 0; i < length; i++)
+
+	// Character is a digit if c - '0', c - 'A' or c - 'a' as unsigned byte is not greater than the limit for its range
+	uint8_t digits_max = (uint8_t)((radix < 10 ? radix : 10) - 1);
+	uint8_t upper_max = (uint8_t)(radix <= 10 ? 0 : (radix <= 36 ? radix - 11 : 25));
+	uint8_t lower_max = (uint8_t)(radix <= 10 ? 0 : (radix <= 36 ? radix - 11 : radix - 37));
+#if defined(AVX2_CONVERSION)
+	__m256i zero_256 = _mm256_set1_epi8('0'), digits_256 = _mm256_set1_epi8((char)digits_max);
+	__m256i upper_256 = _mm256_set1_epi8('A'), upper_max_256 = _mm256_set1_epi8((char)upper_max);
+	__m256i lower_256 = _mm256_set1_epi8('a'), lower_max_256 = _mm256_set1_epi8((char)lower_max);
+	for (; i + 32 <= length; i += 32)
+	{
+		__m256i characters = _mm256_loadu_si256((const __m256i *)(number + i));
+		__m256i values = _mm256_sub_epi8(characters, zero_256);
+		__m256i valid = _mm256_cmpeq_epi8(_mm256_max_epu8(values, digits_256), digits_256);
+		if (radix > 10)
+		{
+			values = _mm256_sub_epi8(characters, upper_256);
+			valid = _mm256_or_si256(valid, _mm256_cmpeq_epi8(_mm256_max_epu8(values, upper_max_256), upper_max_256));
+			values = _mm256_sub_epi8(characters, lower_256);
+			valid = _mm256_or_si256(valid, _mm256_cmpeq_epi8(_mm256_max_epu8(values, lower_max_256), lower_max_256));
+		}
+		if (_mm256_movemask_epi8(valid) != -1)
+		{
+			return FAILURE;
+		}
+	}
+#endif
+#if defined(SSE2_CONVERSION)
+	__m128i zero_128 = _mm_set1_epi8('0'), digits_128 = _mm_set1_epi8((char)digits_max);
+	__m128i upper_128 = _mm_set1_epi8('A'), upper_max_128 = _mm_set1_epi8((char)upper_max);
+	__m128i lower_128 = _mm_set1_epi8('a'), lower_max_128 = _mm_set1_epi8((char)lower_max);
+	for (; i + 16 <= length; i += 16)
+	{
+		__m128i characters = _mm_loadu_si128((const __m128i *)(number + i));
+		__m128i values = _mm_sub_epi8(characters, zero_128);
+		__m128i valid = _mm_cmpeq_epi8(_mm_max_epu8(values, digits_128), digits_128);
+		if (radix > 10)
+		{
+			values = _mm_sub_epi8(characters, upper_128);
+			valid = _mm_or_si128(valid, _mm_cmpeq_epi8(_mm_max_epu8(values, upper_max_128), upper_max_128));
+			values = _mm_sub_epi8(characters, lower_128);
+			valid = _mm_or_si128(valid, _mm_cmpeq_epi8(_mm_max_epu8(values, lower_max_128), lower_max_128));
+		}
+		if (_mm_movemask_epi8(valid) != 0xffff)
+		{
+			return FAILURE;
+		}
+	}
+#elif defined(NEON_CONVERSION)
+	uint8x16_t zero_neon = vdupq_n_u8('0'), digits_neon = vdupq_n_u8(digits_max);
+	uint8x16_t upper_neon = vdupq_n_u8('A'), upper_max_neon = vdupq_n_u8(upper_max);
+	uint8x16_t lower_neon = vdupq_n_u8('a'), lower_max_neon = vdupq_n_u8(lower_max);
+	for (; i + 16 <= length; i += 16)
 	{
-		if (strchr(charset, toupper((*number)[i])) == NULL)
+		uint8x16_t characters = vld1q_u8((const uint8_t *)(number + i));
+		uint8x16_t valid = vcleq_u8(vsubq_u8(characters, zero_neon), digits_neon);
+		if (radix > 10)
+		{
+			valid = vorrq_u8(valid, vcleq_u8(vsubq_u8(characters, upper_neon), upper_max_neon));
+			valid = vorrq_u8(valid, vcleq_u8(vsubq_u8(characters, lower_neon), lower_max_neon));
+		}
+		if (vminvq_u8(valid) != 0xff)
+		{
+			return FAILURE;
+		}
+	}
+#endif
+
+	// Remaining characters
+	for (; i < length; i++)
+	{
+		if (digit_value(number[i], radix) >= (uint32_t)radix)
 		{
 			return FAILURE;
 		}
@@ -273,154 +718,280 @@ int check_syntax(char **number, size_t length, bigint_base base)
 	return SUCCESS;
 }
 
-uint32_t save_binary_segment(char *number)
+// Convert at most 32 / bits digits of base 2^bits to integer
+uint32_t pack_digits(char *number, size_t length, unsigned int bits)
 {
-	// Wrong argument passed to function
-	if (number == NULL)
+	uint32_t limb = 0;
+	size_t i = 0;
+	for (i = 0; i < length; i++)
 	{
-		return 0;
+		limb = (limb << bits) | digit_values[(unsigned char)number[i]];
 	}
+	return limb;
+}
 
-	// Save last 32 digits of the number
-	uint32_t return_number = 0;
-	int i = 0;
-	for (i = 0; i < 32; i++)
-	{
-		return_number |= (number[31 - i] - 48) << i;
-	}
-	return return_number;
+#ifdef SSE2_CONVERSION
+// Convert 16 hexadecimal digits to two limbs; digits are already checked
+void pack_hex_sse2(char *number, uint32_t *limbs)
+{
+	__m128i digits = _mm_loadu_si128((const __m128i *)number);
+
+	// Low nibble of a character is the value of a digit, letters have bit 6 set and need 9 more
+	__m128i letters = _mm_cmpeq_epi8(_mm_and_si128(digits, _mm_set1_epi8(0x40)), _mm_set1_epi8(0x40));
+	__m128i values = _mm_add_epi8(_mm_and_si128(digits, _mm_set1_epi8(0x0f)), _mm_and_si128(letters, _mm_set1_epi8(9)));
+
+	// Join neighbouring digits into bytes
+	__m128i high = _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00ff)), 4);
+	__m128i low = _mm_srli_epi16(values, 8);
+	__m128i bytes = _mm_packus_epi16(_mm_or_si128(high, low), _mm_setzero_si128());
+
+	uint8_t packed[16];
+	_mm_storeu_si128((__m128i *)packed, bytes);
+	limbs[1] = (uint32_t)packed[0] << 24 | (uint32_t)packed[1] << 16 | (uint32_t)packed[2] << 8 | packed[3];
+	limbs[0] = (uint32_t)packed[4] << 24 | (uint32_t)packed[5] << 16 | (uint32_t)packed[6] << 8 | packed[7];
 }
+#endif
 
-int save_binary(bigint return_number, char *number, size_t length)
+// Pack digits of base 2^bits directly into limbs, starting from the least significant ones
+int save_power_of_two(bigint return_number, char *number, size_t length, unsigned int bits)
 {
 	// Wrong arguments passed to function
 	if (return_number == NULL || return_number->first == NULL || number == NULL || length == 0)
 	{
+		bigint_errno = BIGINT_INCORRECT_STRING;
 		return FAILURE;
 	}
 
-	// Determine number of empty bits at the beginning of the number
-	int empty = (length % 32 == 0 ? 0 : 32 - length % 32);
+	// bigint_create() allocates only the first node
+	return_number->last = return_number->first;
+	return_number->length = 1;
+
+	size_t digits_per_limb = 32 / bits;
+	size_t limbs_length = (length * bits + 31) / 32;
+	uint32_t *limbs = (uint32_t *)malloc(limbs_length * sizeof(uint32_t));
+	check_memory_int(limbs);
 
-	// Create new strign and copy the old one
-	char *new_number = (char *)malloc(sizeof(char) * (length + empty));
-	check_memory_int(new_number);
-	memset(new_number, 0, sizeof(char) * (length + empty));
-	int j = 0;
-	for (j = 0; j < empty; j++)
+	size_t i = 0, end = length;
+	if (32 % bits == 0)
 	{
-		new_number[j] = '0';
+#ifdef SSE2_CONVERSION
+		if (bits == 4)
+		{
+			for (; end >= 16; end -= 16, i += 2)
+			{
+				pack_hex_sse2(number + end - 16, limbs + i);
+			}
+		}
+#endif
+		for (; end >= digits_per_limb; end -= digits_per_limb)
+		{
+			limbs[i++] = pack_digits(number + end - digits_per_limb, digits_per_limb, bits);
+		}
+		if (end > 0)
+		{
+			limbs[i++] = pack_digits(number, end, bits);
+		}
 	}
-	strncpy(new_number + empty, number, length);
-
-	// Determine number of nodes
-	return_number->length = (size_t)(length % 32 == 0 ? length / 32 : length / 32 + 1);
-
-	// Fill nodes with values
-	bigint_node *current = return_number->first, *previous = NULL;
-	current->prev = NULL;
-	size_t i = 0;
-	for (i = 0; i < return_number->length; i++)
+	else
 	{
-		current->value = save_binary_segment(new_number + length + empty - 32 * (i + 1));
-		current->next = (bigint_node *)malloc(sizeof(bigint_node));
-		check_memory_int(current->next);
-		initialise_node(current->next);
-		if (i != 0)
+		// Digits of bases 8 and 32 cross limb boundaries
+		uint64_t accumulator = 0;
+		unsigned int filled = 0;
+		for (; end > 0; end--)
 		{
-			current->prev = previous;
+			accumulator |= (uint64_t)digit_values[(unsigned char)number[end - 1]] << filled;
+			filled += bits;
+			if (filled >= 32)
+			{
+				limbs[i++] = (uint32_t)accumulator;
+				accumulator >>= 32;
+				filled -= 32;
+			}
+		}
+		if (filled > 0)
+		{
+			limbs[i++] = (uint32_t)accumulator;
 		}
-		previous = current;
-		current = current->next;
 	}
-	previous->next = NULL;
-	return_number->last = previous;
-
-	// Free allocated memory
-	free(new_number);
-	free(current);
 
-	return SUCCESS;
+	int status = save_limbs(return_number, limbs, limbs_length, return_number->sign);
+	free(limbs);
+	return status;
 }
 
-char *convert_to_binary(char *number, size_t length)
+// Largest power of radix fitting in one limb; its exponent is saved in digits
+uint32_t radix_chunk_base(int radix, size_t *digits)
 {
-	// Wrong arguments passed to function
-	if (number == NULL || length == 0)
+	uint64_t base = (uint64_t)radix;
+	*digits = 1;
+	while (base * (uint64_t)radix <= UINT32_MAX)
 	{
-		return NULL;
+		base *= (uint64_t)radix;
+		(*digits)++;
 	}
+	return (uint32_t)base;
+}
 
-	// Each string matches one hexadecimal digit
-	char *binary_numbers[] = {"0000", "0001", "0010", "0011",
-				  "0100", "0101", "0110", "0111",
-				  "1000", "1001", "1010", "1011",
-				  "1100", "1101", "1110", "1111"};
-	char *hex_digits = "0123456789ABCDEF##########abcdef";
-
-	// Allocate memory for string the function is going to retrun
-	char *return_number = (char *)malloc(length * 4 * sizeof(char) + 1);
-	check_memory_ptr(return_number);
-	memset(return_number, 0, length * 4 * sizeof(char) + 1);
-
-	// Convert each hexadecimal digit into 4 decimal digits
+// Convert digits of one chunk to integer
+uint32_t radix_chunk(char *number, size_t length, int radix)
+{
+	uint32_t chunk = 0;
 	size_t i = 0;
 	for (i = 0; i < length; i++)
 	{
-		sprintf(return_number + 4 * i, "%s", binary_numbers[(strchr(hex_digits, number[i]) - hex_digits) % 16]);
+		chunk = chunk * (uint32_t)radix + digit_value(number[i], radix);
 	}
-
-	return return_number;
+	return chunk;
 }
 
-int get_parity(char *number, size_t length)
+// Chunk base of radix raised to 2^k; powers are computed once for each radix and kept for next conversions
+uint32_t *radix_power(int radix, size_t k, size_t *length)
 {
-	if (number[length - 1] % 2 == 1)
+	static struct radix_cache_entry *powers[MAX_RADIX + 1][sizeof(size_t) * 8];
+
+	struct radix_cache_entry *entry = cache_load(&powers[radix][0]);
+	if (entry == NULL)
 	{
-		number[length - 1] -= 1;
-		return ODD;
+		size_t digits = 0;
+		entry = (struct radix_cache_entry *)malloc(sizeof(struct radix_cache_entry) + sizeof(uint32_t));
+		check_memory_ptr(entry);
+		entry->limbs[0] = radix_chunk_base(radix, &digits);
+		entry->length = 1;
+		entry = cache_publish(&powers[radix][0], entry);
 	}
-	else
+
+	size_t i = 0;
+	struct radix_cache_entry *previous = entry;
+	for (i = 1; i <= k; i++, previous = entry)
 	{
-		return EVEN;
+		entry = cache_load(&powers[radix][i]);
+		if (entry != NULL)
+		{
+			continue;
+		}
+		entry = (struct radix_cache_entry *)malloc(sizeof(struct radix_cache_entry) + 2 * previous->length * sizeof(uint32_t));
+		check_memory_ptr(entry);
+		if (limbs_multiply(entry->limbs, previous->limbs, previous->length, previous->limbs, previous->length) == FAILURE)
+		{
+			free(entry);
+			return NULL;
+		}
+		entry->length = limbs_normalize(entry->limbs, 2 * previous->length);
+		entry = cache_publish(&powers[radix][i], entry);
 	}
+
+	*length = previous->length;
+	return previous->limbs;
 }
 
-void divide_one_digit(char *digit)
+// Convert chunks of digits, the most significant first, to limbs; limbs need count + 1 limbs
+// Short arrays are processed one chunk at a time, long ones are split in halves
+int chunks_to_limbs(uint32_t *chunks, size_t count, int radix, uint32_t *limbs, size_t *limbs_length, int threads)
 {
-	if (digit[0] % 2 == 1)
+	size_t chunk_digits = 0;
+	uint32_t chunk_base = radix_chunk_base(radix, &chunk_digits);
+	size_t i = 0, length = 0;
+	if (count * chunk_digits <= RADIX_CONVERSION_THRESHOLD)
 	{
-		digit[0] -= 1;
-		digit[1] += 5;
+		uint64_t carry = 0;
+		size_t j = 0;
+		for (i = 0; i < count; i++)
+		{
+			carry = chunks[i];
+			for (j = 0; j < length; j++)
+			{
+				carry += (uint64_t)limbs[j] * chunk_base;
+				limbs[j] = (uint32_t)carry;
+				carry >>= 32;
+			}
+			if (carry != 0)
+			{
+				limbs[length++] = (uint32_t)carry;
+			}
+		}
+		*limbs_length = length;
+		return SUCCESS;
 	}
-	digit[0] = (digit[0] - 48) / 2 + 48;
-}
 
-void divide_digits(char *number, size_t length)
-{
-	size_t i = length - 1;
-	do
+	// chunks = high * chunk_base^(2^k) + low, low has 2^k chunks
+	size_t k = 0;
+	while ((size_t)1 << (k + 1) < count)
+	{
+		k++;
+	}
+	size_t low_count = (size_t)1 << k;
+	size_t high_count = count - low_count;
+	size_t power_length = 0, high_length = 0, low_length = 0;
+	uint32_t *power = radix_power(radix, k, &power_length);
+	check_memory_int(power);
+
+	uint32_t *high = (uint32_t *)malloc((high_count + 1 + low_count + 1) * sizeof(uint32_t));
+	check_memory_int(high);
+	uint32_t *low = high + high_count + 1;
+
+	// Halves are independent, so the high one may be converted by another thread
+	struct conversion_task task;
+	memset(&task, 0, sizeof(struct conversion_task));
+	task.function = task_chunks_to_limbs;
+	task.chunks = chunks;
+	task.count = high_count;
+	task.radix = radix;
+	task.limbs = high;
+	task.threads = threads / 2;
+	task_start(&task, threads > 1 && count >= PARALLEL_CONVERSION_THRESHOLD);
+	int status = chunks_to_limbs(chunks + high_count, low_count, radix, low, &low_length, threads - threads / 2);
+	if (task_finish(&task) == FAILURE || status == FAILURE)
+	{
+		free(high);
+		return FAILURE;
+	}
+	high_length = task.length;
+
+	if (high_length == 0)
+	{
+		memcpy(limbs, low, low_length * sizeof(uint32_t));
+		*limbs_length = low_length;
+		free(high);
+		return SUCCESS;
+	}
+	if (limbs_multiply(limbs, high, high_length, power, power_length) == FAILURE)
 	{
-		divide_one_digit(number + i);
-		i--;
-	} while (i != 0);
-	divide_one_digit(number + i);
+		free(high);
+		return FAILURE;
+	}
+	length = high_length + power_length;
+	limbs[length] = limbs_add(limbs, limbs, length, low, low_length);
+	*limbs_length = limbs_normalize(limbs, length + 1);
+
+	free(high);
+	return SUCCESS;
 }
 
-int is_zero(char *number, size_t length)
+// Convert digits of given base to limbs; limbs need length / d + 3 limbs, where d is the number of digits in one chunk
+int radix_to_limbs(char *number, size_t length, int radix, uint32_t *limbs, size_t *limbs_length)
 {
+	size_t chunk_digits = 0;
+	radix_chunk_base(radix, &chunk_digits);
+
+	// The first chunk is shorter if length is not a multiple of chunk length
+	size_t first = (length % chunk_digits == 0 ? chunk_digits : length % chunk_digits);
+	size_t count = (length - first) / chunk_digits + 1;
+	uint32_t *chunks = (uint32_t *)malloc(count * sizeof(uint32_t));
+	check_memory_int(chunks);
+
 	size_t i = 0;
-	for (i = 0; i < length; i++)
+	chunks[0] = radix_chunk(number, first, radix);
+	for (i = 1; i < count; i++)
 	{
-		if (number[i] != '0')
-		{
-			return FALSE;
-		}
+		chunks[i] = radix_chunk(number + first + (i - 1) * chunk_digits, chunk_digits, radix);
 	}
-	return TRUE;
+
+	int status = chunks_to_limbs(chunks, count, radix, limbs, limbs_length, conversion_threads(count));
+	free(chunks);
+	return status;
 }
 
-int save_decimal(bigint return_number, char *number, size_t length)
+int save_radix(bigint return_number, char *number, size_t length, int radix)
 {
 	// Wrong arguments passed to function
 	if (return_number == NULL || number == NULL || length == 0)
@@ -429,62 +1000,70 @@ int save_decimal(bigint return_number, char *number, size_t length)
 		return FAILURE;
 	}
 
-	// Create copy of 'number' string
-	char *duplicate = malloc(length * sizeof(char));
-	check_memory_int(duplicate);
-	strncpy(duplicate, number, length);
+	// bigint_create() allocates only the first node
+	return_number->last = return_number->first;
+	return_number->length = 1;
 
-	// Variables used in the loop
-	size_t count = 0, nodes = 1;
-	uint32_t segment = 0;
-	bigint_node *current = return_number->first, *previous = NULL;
-	check_memory_int(current);
-	current->prev = NULL;
+	size_t chunk_digits = 0;
+	radix_chunk_base(radix, &chunk_digits);
+	uint32_t *limbs = (uint32_t *)malloc((length / chunk_digits + 3) * sizeof(uint32_t));
+	check_memory_int(limbs);
+	size_t limbs_length = 0;
+	int status = radix_to_limbs(number, length, radix, limbs, &limbs_length);
+	if (status == SUCCESS)
+	{
+		status = save_limbs(return_number, limbs, limbs_length, return_number->sign);
+	}
+
+	free(limbs);
+	return status;
+}
+
+// Create bigint from checked digits; powers of two are packed directly, other bases are converted by halves
+bigint create_from_digits(char *number, size_t length, uint8_t sign, int radix)
+{
+	// Allocate memory for bigint
+	bigint return_number = (bigint)malloc(sizeof(struct bigint_data_structure));
+	check_memory_ptr(return_number);
+	initialise_bigint(return_number);
 
-	// One digit number
-	if (length == 1)
+	return_number->sign = sign;
+	return_number->first = (bigint_node *)malloc(sizeof(bigint_node));
+	if (return_number->first == NULL)
 	{
-		return_number->first->value = (uint32_t)(number[0] - 48);
-		return_number->last = return_number->first;
-		return_number->length = 1;
-		free(duplicate);
-		return SUCCESS;
+		free(return_number);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return NULL;
 	}
+	initialise_node(return_number->first);
+	return_number->last = return_number->first;
+	return_number->length = 1;
 
-	// Divide by two and get the remainder until zero
-	while (!is_zero(duplicate, length))
+	// Create bigint
+	int correct = SUCCESS;
+	if ((radix & (radix - 1)) == 0)
+	{
+		correct = save_power_of_two(return_number, number, length, (unsigned int)bit_len((uint32_t)radix) - 1);
+	}
+	else
 	{
+		correct = save_radix(return_number, number, length, radix);
+	}
 
-		// Fill in next digit in one node
-		segment |= (uint32_t)get_parity(duplicate, length) << count;
-		divide_digits(duplicate, length);
-		count++;
+	// Check save functions performance; they have already set bigint_errno
+	if (correct == FAILURE)
+	{
+		bigint_release_basic(return_number);
+		return NULL;
+	}
 
-		// Go to another node
-		if (count == 32)
-		{
-			nodes++;
-			current->value = segment;
-			count = 0;
-			segment = 0;
-			current->next = (bigint_node *)malloc(sizeof(bigint_node));
-			check_memory_int(current->next);
-			initialise_node(current->next);
-			if (nodes != 2)
-			{
-				current->prev = previous;
-			}
-			previous = current;
-			current = current->next;
-		}
+	// Zero cannot be negative
+	if (return_number->length == 1 && return_number->first->value == 0)
+	{
+		return_number->sign = 0;
 	}
 
-	current->value = segment;
-	current->prev = previous;
-	return_number->length = nodes;
-	return_number->last = current;
-	free(duplicate);
-	return SUCCESS;
+	return return_number;
 }
 
 bigint bigint_create(char *number, size_t length)
@@ -509,45 +1088,33 @@ bigint bigint_create(char *number, size_t length)
 		return NULL;
 	}
 
-	// Allocate memory for bigint
-	bigint return_number = (bigint)malloc(sizeof(struct bigint_data_structure));
-	check_memory_ptr(return_number);
-	initialise_bigint(return_number);
+	return create_from_digits(number, length, sign, base_radixes[base]);
+}
 
-	return_number->sign = sign;
-	return_number->first = (bigint_node *)malloc(sizeof(bigint_node));
-	check_memory_ptr(return_number->first);
-	initialise_node(return_number->first);
+bigint bigint_create_radix(char *number, size_t length, int radix)
+{
 
-	// Create bigint
-	if (base == BIN)
-	{
-		correct = save_binary(return_number, number, length);
-	}
-	else if (base == HEX)
-	{
-		char *binary_number = convert_to_binary(number, length);
-		correct = save_binary(return_number, binary_number, length * 4);
-		free(binary_number);
-	}
-	else
+	// Wrong arguments passed to function
+	if (radix < 2 || radix > MAX_RADIX)
 	{
-		correct = save_decimal(return_number, number, length);
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
 	}
-
-	// Check save functions performance
-	if (correct == FAILURE)
+	if (number == NULL || length == 0)
 	{
+		bigint_errno = BIGINT_INCORRECT_STRING;
 		return NULL;
 	}
 
-	// Zero cannot be negative
-	if (return_number->length == 1 && return_number->first->value == 0)
+	// Sign is optional, there is no prefix and leading zeros are allowed
+	uint8_t sign = check_sign(&number, &length);
+	if (length == 0 || check_digits(number, length, radix) == FAILURE)
 	{
-		return_number->sign = 0;
+		bigint_errno = BIGINT_INCORRECT_STRING;
+		return NULL;
 	}
 
-	return return_number;
+	return create_from_digits(number, length, sign, radix);
 }
 
 bigint bigint_convert_to_bigint(void *integer, size_t length)
@@ -566,51 +1133,19 @@ bigint bigint_convert_to_bigint(void *integer, size_t length)
 		return NULL;
 	}
 
-	// Check endianness
-	int endianness = check_endian();
-	uint32_t *integer32 = (uint32_t *)integer;
-
-	size_t segments = length / 4;
-	size_t i = 0;
-	bigint return_number = bigint_create_empty_segments(segments);
-
-	// Fill nodes with values
-	bigint_node *current = return_number->first;
-	for (i = 0; i < segments; i++)
+	bigint return_number = bigint_create_empty_segments(1);
+	if (return_number == NULL)
 	{
-		if (endianness == -1)
-		{
-			// Little endian
-			current->value = (integer32[i]);
-		}
-		else
-		{
-			// Big endian
-			current->value = (integer32[segments - i - 1]);
-		}
-		current = current->next;
+		return NULL;
 	}
 
-	// Delete leading nodes with 0 value
-	bigint_node *temp = NULL;
-	current = return_number->last;
-	// leave one segment in case number equals zero
-	for (i = 1; i < segments; i++)
+	// Integer is one word with native byte order
+	if (bigint_import(return_number, 1, 1, length, 0, integer) == FAILURE)
 	{
-		if (current->value == 0)
-		{
-			return_number->length -= 1;
-			return_number->last = current->prev;
-			current->prev->next = NULL;
-			temp = current;
-			free(current);
-			current = temp->prev;
-		}
-		else
-		{
-			break;
-		}
+		bigint_release_basic(return_number);
+		return NULL;
 	}
+
 	return return_number;
 }
 
@@ -627,1087 +1162,1258 @@ int bigint_convert_to_int(bigint number, uintmax_t *integer)
 	// Clear target integer
 	*integer = 0;
 
-	// Check if bigint is small enough
-	uintmax_t max_value_i = UINTMAX_MAX;
-	bigint max_value_b = bigint_convert_to_bigint(&max_value_i, sizeof(uintmax_t));
-	if (bigint_compare_absolute(max_value_b, number) == -1)
-	{
-		bigint_errno = BIGINT_TOO_LARGE_BIGINT_TO_CONVERT;
-		bigint_release_basic(max_value_b);
-		return FAILURE;
-	}
-	bigint_release_basic(max_value_b);
-
-	// Conversion
-	int endianness = check_endian();
-	uint32_t *integer32 = (uint32_t *)integer;
-	size_t segments = number->length;
+	// Check if bigint is small enough; segments above the size of integer must be zeros
+	size_t segments = sizeof(uintmax_t) / 4;
 	size_t i = 0;
 	bigint_node *current = number->first;
-	for (i = 0; i < segments; i++)
+	for (i = 0; current != NULL; i++, current = current->next)
 	{
-		if (endianness == -1)
+		if (i >= segments && current->value != 0)
 		{
-			// Little endian
-			integer32[i] = current->value;
+			bigint_errno = BIGINT_TOO_LARGE_BIGINT_TO_CONVERT;
+			*integer = 0;
+			return FAILURE;
 		}
-		else
+		if (i < segments)
 		{
-			// Big endian
-			integer32[segments - i - 1] = current->value;
+			*integer |= (uintmax_t)current->value << (32 * i);
 		}
-		current = current->next;
 	}
 
 	return SUCCESS;
 }
 
-bigint bigint_create_empty_segments(size_t count)
+// Read absolute value of number that has at most 64 bits; segments above the second one must be zeros
+int get_u64(bigint number, uint64_t *magnitude)
 {
-	// Wrong argument
-	if (count == 0)
+	*magnitude = number->first->value;
+	if (number->length == 1)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return NULL;
+		return SUCCESS;
 	}
 
-	bigint return_number = (bigint)malloc(sizeof(struct bigint_data_structure));
-	check_memory_ptr(return_number);
-	initialise_bigint(return_number);
-
-	return_number->first = (bigint_node *)malloc(sizeof(bigint_node));
-	check_memory_ptr(return_number->first);
-	initialise_node(return_number->first);
-	return_number->length = count;
-	bigint_node *current = return_number->first;
-	bigint_node *previous = NULL;
-	size_t i = 0;
-
-	for (i = 1; i < count; i++)
+	*magnitude |= (uint64_t)number->first->next->value << 32;
+	bigint_node *current = NULL;
+	for (current = number->first->next->next; current != NULL; current = current->next)
 	{
-		current->next = (bigint_node *)malloc(sizeof(bigint_node));
-		check_memory_ptr(current->next);
-		initialise_node(current->next);
-		if (i != 1)
+		if (current->value != 0)
 		{
-			current->prev = previous;
+			return FAILURE;
 		}
-		previous = current;
-		current = current->next;
 	}
-	return_number->last = current;
-	current->prev = previous;
-	return_number->last->next = NULL;
-	return return_number;
+
+	return SUCCESS;
 }
 
-int print_bits(uint32_t num)
+// Save 64-bit absolute value and sign in number; existing nodes are reused
+int set_u64(bigint number, uint64_t magnitude, uint8_t sign)
 {
-	int i = 0;
-	for (i = 31; i >= 0; i--)
+	if (resize_segments(number, ((magnitude >> 32) != 0 ? 2 : 1)) == FAILURE)
 	{
-		if ((num >> i) & 1)
-		{
-			printf("1");
-		}
-		else
-		{
-			printf("0");
-		}
+		return FAILURE;
 	}
-	return SUCCESS;
-}
 
-// Omit leading zeros
-int print_bits_first_element(uint32_t num)
-{
-	int i = 0;
-	for (i = (int)bit_len(num) - 1; i >= 0; i--)
+	number->first->value = (uint32_t)magnitude;
+	if (number->length == 2)
 	{
-		if ((num >> i) & 1)
-		{
-			printf("1");
-		}
-		else
-		{
-			printf("0");
-		}
+		number->last->value = (uint32_t)(magnitude >> 32);
 	}
+
+	// Zero cannot be negative
+	number->sign = (magnitude == 0 ? POSITIVE : sign);
+
 	return SUCCESS;
 }
 
-// Save values of nodes in linked list to array
-uint32_t *copy_to_chain(bigint number)
+bigint bigint_from_i64(int64_t value)
 {
-
-	uint32_t *return_chain = (uint32_t *)malloc(number->length * sizeof(uint32_t));
-	check_memory_ptr(return_chain);
-	memset(return_chain, 0, number->length * sizeof(uint32_t));
-
-	size_t i = 0;
-	bigint_node *current = number->last;
-	for (i = 0; i < number->length; i++)
+	uint64_t magnitude = (value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value);
+	bigint return_number = bigint_create_empty_segments(((magnitude >> 32) != 0 ? 2 : 1));
+	if (return_number == NULL)
 	{
-		return_chain[i] = current->value;
-		current = current->prev;
+		return NULL;
 	}
 
-	return return_chain;
+	set_u64(return_number, magnitude, (value < 0 ? NEGATIVE : POSITIVE));
+	return return_number;
 }
 
-// Number of digits in binary system
-size_t bit_len(uint32_t number)
+bigint bigint_from_u64(uint64_t value)
 {
-
-	if (number == 0)
+	bigint return_number = bigint_create_empty_segments(((value >> 32) != 0 ? 2 : 1));
+	if (return_number == NULL)
 	{
-		return 0;
+		return NULL;
 	}
 
-	size_t i = 0;
-	for (i = 31; i != 0; i--)
+	set_u64(return_number, value, POSITIVE);
+	return return_number;
+}
+
+int bigint_set_i64(bigint number, int64_t value)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
 	{
-		if ((number >> i) & 1)
-		{
-			return i + 1;
-		}
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	return 1;
+	uint64_t magnitude = (value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value);
+	return set_u64(number, magnitude, (value < 0 ? NEGATIVE : POSITIVE));
 }
 
-// Gets bit no 'number' from 'chain' array
-uint8_t get_n_bit(uint32_t *chain, size_t length, size_t number)
+int bigint_set_u64(bigint number, uint64_t value)
 {
 
-	if (chain == NULL || (number / 32) + 1 > length)
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
 	{
-		return 0;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	uint32_t current = chain[length - 1 - (number / 32)];
-	if (current & (1 << (number % 32)))
-	{
-		return 1;
-	}
-	else
-	{
-		return 0;
-	}
+	return set_u64(number, value, POSITIVE);
 }
 
-// Sets bit no 'number' in 'chain' array to one
-int set_n_bit_to_1(uint32_t *chain, size_t length, size_t number)
+int bigint_to_i64(bigint number, int64_t *value)
 {
 
-	if (chain == NULL || (number / 32) + 1 > length)
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL || value == NULL)
 	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	uint32_t *current = chain + (length - 1 - (number / 32));
-	*(current) |= (1 << (number % 32));
+	// Negative numbers reach 2^63, positive ones 2^63 - 1
+	uint64_t magnitude = 0;
+	uint64_t limit = (number->sign == NEGATIVE ? (uint64_t)1 << 63 : ((uint64_t)1 << 63) - 1);
+	if (get_u64(number, &magnitude) == FAILURE || magnitude > limit)
+	{
+		bigint_errno = BIGINT_TOO_LARGE_BIGINT_TO_CONVERT;
+		return FAILURE;
+	}
 
+	// Negation is done on unsigned type, so -2^63 does not overflow
+	*value = (number->sign == NEGATIVE ? -(int64_t)(magnitude - 1) - 1 : (int64_t)magnitude);
 	return SUCCESS;
 }
 
-// Divide two numbers
-uint64_t divide(uint32_t *divident, uint32_t *quotient, size_t count)
+int bigint_to_u64(bigint number, uint64_t *value)
 {
 
-	if (divident == NULL || quotient == NULL || count == 0)
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL || value == NULL)
 	{
-		return 0;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	uint32_t d = 1000000000;
-	uint64_t r = 0;
-	size_t length = count * 32 - 32 + bit_len(divident[0]);
-
-	int i = 0;
-	for (i = length - 1; i >= 0; i--)
+	uint64_t magnitude = 0;
+	if (number->sign == NEGATIVE || get_u64(number, &magnitude) == FAILURE)
 	{
-		r <<= 1;
-		r |= get_n_bit(divident, count, i);
-		if (r >= d)
-		{
-			r -= d;
-			set_n_bit_to_1(quotient, count, i);
-		}
+		bigint_errno = BIGINT_TOO_LARGE_BIGINT_TO_CONVERT;
+		return FAILURE;
 	}
 
-	return r;
+	*value = magnitude;
+	return SUCCESS;
 }
 
-// Find non-zero array element
-size_t chain_length(uint32_t *chain, size_t max_count)
+int bigint_fits_i64(bigint number)
 {
 
-	if (chain == NULL || max_count == 0)
-	{
-		return 0;
-	}
-
-	size_t i = 0;
-	for (i = 0; i < max_count; i++)
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
 	{
-		if (chain[i] != 0)
-		{
-			return max_count - i;
-		}
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FALSE;
 	}
 
-	return 0;
+	uint64_t magnitude = 0;
+	uint64_t limit = (number->sign == NEGATIVE ? (uint64_t)1 << 63 : ((uint64_t)1 << 63) - 1);
+	return (get_u64(number, &magnitude) == SUCCESS && magnitude <= limit ? TRUE : FALSE);
 }
 
-int print_decimal(bigint number)
+int bigint_fits_u64(bigint number)
 {
 
+	// Wrong arguments passed to function
 	if (number == NULL || number->first == NULL)
 	{
-		return FAILURE;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FALSE;
 	}
 
-	if (number->length == 1)
+	uint64_t magnitude = 0;
+	return (number->sign != NEGATIVE && get_u64(number, &magnitude) == SUCCESS ? TRUE : FALSE);
+}
+
+// Position in data of byte with given significance, where endian is already 1 or -1
+size_t raw_byte_offset(size_t index, size_t count, int order, size_t size, int endian)
+{
+	size_t word = index / size;
+	size_t byte = index % size;
+	return (order == 1 ? count - 1 - word : word) * size + (endian == 1 ? size - 1 - byte : byte);
+}
+
+int bigint_import(bigint result, size_t count, int order, size_t size, int endian, const void *data)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || (data == NULL && count != 0) || size == 0 || (order != 1 && order != -1) ||
+	    (endian != 1 && endian != -1 && endian != 0))
 	{
-		printf("%" PRINTING_FORMAT_SPECIFIER, (PRINTING_TYPE)number->first->value);
-		return SUCCESS;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	uint32_t *chain = copy_to_chain(number);
-	if (chain == NULL)
+	// Number of bytes rounded up to whole limbs must not overflow
+	if (count > (SIZE_MAX - 3) / size)
 	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	size_t count = number->length;
-
-	// Amount of memory needed in decimal system
-	size_t decimal_digits = count * 10 + 1;
-	size_t decimal_segments = (decimal_digits % 9 == 0 ? decimal_digits / 9 : decimal_digits / 9 + 1);
-	uint32_t *result = (uint32_t *)malloc(decimal_segments * sizeof(uint32_t));
-	check_memory_int(result);
-	memset(result, 0, decimal_segments * sizeof(uint32_t));
-
-	uint32_t *q1 = (uint32_t *)malloc(sizeof(uint32_t) * count);
-	uint32_t *q2 = (uint32_t *)malloc(sizeof(uint32_t) * count);
-	memset(q1, 0, count * sizeof(uint32_t));
-	memset(q2, 0, count * sizeof(uint32_t));
-	memcpy(q1, chain, count * sizeof(uint32_t));
+	size_t bytes = count * size;
+	size_t length = (bytes + 3) / 4;
+	uint32_t *limbs = (uint32_t *)malloc((length != 0 ? length : 1) * sizeof(uint32_t));
+	check_memory_int(limbs);
+	memset(limbs, 0, (length != 0 ? length : 1) * sizeof(uint32_t));
 
-	uint64_t r = 0;
-	uint32_t *arr[] = {q1, q2};
+	int native = check_endian();
+	endian = (endian == 0 ? native : endian);
+	const uint8_t *source = (const uint8_t *)data;
 
-	size_t i = 0;
-	for (i = 0; i < decimal_segments; i++)
+	// Least significant byte first matches limbs of little endian machine
+	if (native == BIGINT_LITTLE_ENDIAN && order == -1 && (endian == -1 || size == 1))
 	{
-		memset(arr[(i + 1) % 2], 0, count * (sizeof(uint32_t)));
-		size_t shift = count - chain_length(arr[i % 2], count);
-		r = divide(arr[i % 2] + shift, arr[(i + 1) % 2] + shift, chain_length(arr[i % 2], count));
-		result[decimal_segments - i - 1] = r;
+		memcpy(limbs, source, bytes);
 	}
-
-	size_t j = 0;
-	size_t k = 0;
-	for (k = 0; k < decimal_segments; k++)
+	else
 	{
-		if (result[k] == 0 && decimal_segments != 1)
-		{
-			j++;
-		}
-		else
+		size_t i = 0;
+		for (i = 0; i < bytes; i++)
 		{
-			break;
+			limbs[i / 4] |= (uint32_t)source[raw_byte_offset(i, count, order, size, endian)] << (8 * (i % 4));
 		}
 	}
-	k = 0;
-	for (; j < decimal_segments; j++)
+
+	int status = save_limbs(result, limbs, length, POSITIVE);
+	free(limbs);
+	return status;
+}
+
+size_t bigint_export_count(bigint number, size_t size)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->last == NULL || size == 0)
 	{
-		if (k == 0)
-		{
-			printf("%" PRINTING_FORMAT_SPECIFIER, (PRINTING_TYPE)result[j]);
-			k++;
-			continue;
-		}
-		printf("%09" PRINTING_FORMAT_SPECIFIER, (PRINTING_TYPE)result[j]);
-		k++;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
 	}
 
-	free(result);
-	free(chain);
-	free(q1);
-	free(q2);
-
-	return SUCCESS;
+	// Counted in bytes, so that large size cannot overflow
+	size_t bytes = 4 * (number->length - 1) + (bit_len(number->last->value) + 7) / 8;
+	return bytes / size + (bytes % size != 0 ? 1 : 0);
 }
 
-int bigint_print(FILE *stream, bigint_base base, bigint number)
+int bigint_export(void *data, size_t *count, int order, size_t size, int endian, bigint number)
 {
 
 	// Wrong arguments passed to function
-	if (stream == NULL || (base != BIN && base != DEC && base != HEX) || number == NULL)
+	if (data == NULL || count == NULL || number == NULL || number->first == NULL || size == 0 ||
+	    (order != 1 && order != -1) || (endian != 1 && endian != -1 && endian != 0))
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	if (number->sign == NEGATIVE)
+	// Number of bytes of all words must not overflow
+	size_t words = bigint_export_count(number, size);
+	if (words > SIZE_MAX / size)
 	{
-		printf("-");
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	if (base == BIN)
+	*count = words;
+	size_t bytes = *count * size;
+	if (bytes == 0)
 	{
-		printf("0b");
-	}
-	else if (base == HEX)
-	{
-		printf("0x");
+		return SUCCESS;
 	}
 
-	if (base == DEC)
-	{
-		return (print_decimal(number));
-	}
+	size_t length = 0;
+	uint32_t *limbs = copy_to_limbs(number, &length);
+	check_memory_int(limbs);
 
-	bigint_node *current = number->last;
+	int native = check_endian();
+	endian = (endian == 0 ? native : endian);
+	uint8_t *target = (uint8_t *)data;
 
-	// Don't print zeros at the beginning
-	if (base == BIN)
+	// Limbs of little endian machine are already least significant byte first
+	if (native == BIGINT_LITTLE_ENDIAN && order == -1 && (endian == -1 || size == 1))
 	{
-		print_bits_first_element(current->value);
+		memset(target, 0, bytes);
+		memcpy(target, limbs, (bytes < 4 * length ? bytes : 4 * length));
 	}
 	else
 	{
-		printf("%x", current->value);
-	}
-	current = current->prev;
-
-	size_t i = number->length;
-	for (; i > 1; i--)
-	{
-		if (base == BIN)
-		{
-			print_bits(current->value);
-		}
-		else
+		size_t i = 0;
+		for (i = 0; i < bytes; i++)
 		{
-			printf("%08x", current->value);
+			target[raw_byte_offset(i, *count, order, size, endian)] = (uint8_t)(i / 4 < length ? limbs[i / 4] >> (8 * (i % 4)) : 0);
 		}
-		current = current->prev;
 	}
 
+	free(limbs);
 	return SUCCESS;
 }
 
-int bigint_release_basic(bigint number)
+bigint bigint_create_empty_segments(size_t count)
 {
-
-	// Wrong arguments passed to function
-	if (number == NULL)
+	// Wrong argument
+	if (count == 0)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		return NULL;
 	}
 
-	bigint_node *current = number->first;
-	bigint_node *previous = NULL;
-	size_t i = 0;
-	for (i = 0; i < number->length; i++)
-	{
-		previous = current;
-		current = current->next;
-		free(previous);
-	}
+	bigint return_number = (bigint)malloc(sizeof(struct bigint_data_structure));
+	check_memory_ptr(return_number);
+	initialise_bigint(return_number);
 
-	free(number);
+	return_number->first = (bigint_node *)malloc(sizeof(bigint_node));
+	check_memory_ptr(return_number->first);
+	initialise_node(return_number->first);
+	return_number->length = count;
+	bigint_node *current = return_number->first;
+	bigint_node *previous = NULL;
+	size_t i = 0;
 
-	// current should be null
-	if (current != NULL)
+	for (i = 1; i < count; i++)
 	{
-		bigint_errno = BIGINT_ERROR_IN_DATA_STRUCTURE;
-		return FAILURE;
+		current->next = (bigint_node *)malloc(sizeof(bigint_node));
+		check_memory_ptr(current->next);
+		initialise_node(current->next);
+		if (i != 1)
+		{
+			current->prev = previous;
+		}
+		previous = current;
+		current = current->next;
 	}
-
-	return SUCCESS;
+	return_number->last = current;
+	current->prev = previous;
+	return_number->last->next = NULL;
+	return return_number;
 }
 
-int bigint_release_segments(bigint number)
+// Save values of nodes in linked list to array
+uint32_t *copy_to_chain(bigint number)
 {
 
-	// Wrong arguments passed to function
-	if (number == NULL)
-	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
-	}
+	uint32_t *return_chain = (uint32_t *)malloc(number->length * sizeof(uint32_t));
+	check_memory_ptr(return_chain);
+	memset(return_chain, 0, number->length * sizeof(uint32_t));
 
-	bigint_node *current = number->first;
-	bigint_node *previous = NULL;
 	size_t i = 0;
+	bigint_node *current = number->last;
 	for (i = 0; i < number->length; i++)
 	{
-		previous = current;
-		current = current->next;
-		free(previous);
-	}
-
-	// current should be null
-	if (current != NULL)
-	{
-		bigint_errno = BIGINT_ERROR_IN_DATA_STRUCTURE;
-		return FAILURE;
+		return_chain[i] = current->value;
+		current = current->prev;
 	}
 
-	return SUCCESS;
+	return return_chain;
 }
 
-int bigint_release(int count, ...)
+// Number of digits in binary system
+size_t bit_len(uint32_t number)
 {
-	// Wrong argument
-	if (count < 0)
-	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
-	}
-	else if (count == 0)
+
+	if (number == 0)
 	{
-		return SUCCESS;
+		return 0;
 	}
 
-	va_list ap;
-	va_start(ap, count);
-	int status = SUCCESS;
-	int i = 0;
-	for (i = 0; i < count; i++)
+#if defined(BUILTIN_BIT_COUNTING)
+	return 32 - (size_t)__builtin_clz(number);
+#elif defined(MSVC_BIT_COUNTING)
+	unsigned long index = 0;
+	_BitScanReverse(&index, number);
+	return (size_t)index + 1;
+#else
+	// Binary search for the highest set bit
+	size_t length = 1;
+	unsigned int step = 16;
+	for (; step != 0; step /= 2)
 	{
-		status = bigint_release_basic(va_arg(ap, bigint));
-		if (status == FAILURE)
+		if ((number >> step) != 0)
 		{
-			return status;
+			number >>= step;
+			length += step;
 		}
 	}
-	va_end(ap);
-
-	return SUCCESS;
+	return length;
+#endif
 }
 
-size_t bigint_size(bigint number)
+// Number of ones in 32-bit word
+unsigned int popcount_32(uint32_t number)
 {
-	// Wrong arguments passed to function
-	if (number == NULL)
-	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
-	}
+#if defined(BUILTIN_BIT_COUNTING)
+	return (unsigned int)__builtin_popcount(number);
+#else
+	number = number - ((number >> 1) & 0x55555555);
+	number = (number & 0x33333333) + ((number >> 2) & 0x33333333);
+	number = (number + (number >> 4)) & 0x0f0f0f0f;
+	return (number * 0x01010101) >> 24;
+#endif
+}
 
-	return sizeof(struct bigint_data_structure) + (number->length * sizeof(bigint_node));
+// Number of zeros below the lowest one; number must not be 0
+unsigned int trailing_zeros(uint32_t number)
+{
+#if defined(BUILTIN_BIT_COUNTING)
+	return (unsigned int)__builtin_ctz(number);
+#elif defined(MSVC_BIT_COUNTING)
+	unsigned long index = 0;
+	_BitScanForward(&index, number);
+	return (unsigned int)index;
+#else
+	return (unsigned int)bit_len(number & (~number + 1)) - 1;
+#endif
 }
 
-int bigint_get_sign(bigint number)
+// Gets bit no 'number' from 'chain' array
+uint8_t get_n_bit(uint32_t *chain, size_t length, size_t number)
 {
 
-	// Wrong argument passed to function
-	if (number == NULL)
+	if (chain == NULL || (number / 32) + 1 > length)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		return 0;
 	}
 
-	return number->sign;
+	uint32_t current = chain[length - 1 - (number / 32)];
+	if (current & (1 << (number % 32)))
+	{
+		return 1;
+	}
+	else
+	{
+		return 0;
+	}
 }
 
-int bigint_absolute_value(bigint number)
+// Sets bit no 'number' in 'chain' array to one
+int set_n_bit_to_1(uint32_t *chain, size_t length, size_t number)
 {
 
-	// Wrong argument passed to funcion
-	if (number == NULL)
+	if (chain == NULL || (number / 32) + 1 > length)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	number->sign = 0;
+	uint32_t *current = chain + (length - 1 - (number / 32));
+	*(current) |= (1 << (number % 32));
 
 	return SUCCESS;
 }
 
-int bigint_change_sign(bigint number)
+// Find non-zero array element
+size_t chain_length(uint32_t *chain, size_t max_count)
 {
 
-	// Wrong argument passed to function
-	if (number == NULL)
+	if (chain == NULL || max_count == 0)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		return 0;
+	}
+
+	size_t i = 0;
+	for (i = 0; i < max_count; i++)
+	{
+		if (chain[i] != 0)
+		{
+			return max_count - i;
+		}
 	}
 
-	number->sign = (number->sign == 1 ? 0 : 1);
+	return 0;
+}
 
-	return SUCCESS;
+// Characters used for digits; above base 36 lowercase letters follow uppercase ones
+const char *digit_characters(int radix)
+{
+	return (radix > 36 ? "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz" : "0123456789abcdefghijklmnopqrstuvwxyz");
 }
 
-int add_segments_beginning(bigint number, size_t count)
+// Write given number of digits of chunk with leading zeros; decimal digits are written two at a time
+void write_radix_chunk(char *buffer, uint32_t chunk, int radix, size_t digits)
 {
-	// Wrong arguments
-	if (number == NULL)
+	static const char pairs[] =
+		"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+		"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+		"8081828384858687888990919293949596979899";
+
+	int i = (int)digits - 1;
+	if (radix == 10)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		for (; i > 0; i -= 2)
+		{
+			memcpy(buffer + i - 1, pairs + 2 * (chunk % 100), 2);
+			chunk /= 100;
+		}
+		if (i == 0)
+		{
+			buffer[0] = (char)('0' + chunk);
+		}
+		return;
 	}
 
-	if (count == 0)
+	const char *characters = digit_characters(radix);
+	for (; i >= 0; i--)
 	{
-		return SUCCESS;
+		buffer[i] = characters[chunk % (uint32_t)radix];
+		chunk /= (uint32_t)radix;
 	}
-	number->length += count;
+}
 
-	bigint_node *current = (bigint_node *)malloc(sizeof(bigint_node));
-	bigint_node *temp = current;
-	check_memory_int(current);
-	initialise_node(current);
+// Reciprocal of chunk base raised to 2^k used to divide by it; reciprocals are kept like the powers
+uint32_t *radix_reciprocal(int radix, size_t k, size_t *length)
+{
+	static struct radix_cache_entry *reciprocals[MAX_RADIX + 1][sizeof(size_t) * 8];
 
-	size_t i = 0;
-	for (i = 0; i < count - 1; i++)
+	struct radix_cache_entry *entry = cache_load(&reciprocals[radix][k]);
+	if (entry == NULL)
 	{
-		current->next = (bigint_node *)malloc(sizeof(bigint_node));
-		check_memory_int(current->next);
-		initialise_node(current->next);
-		current->next->prev = current;
-		current = current->next;
+		size_t power_length = 0;
+		uint32_t *power = radix_power(radix, k, &power_length);
+		check_memory_ptr(power);
+		entry = (struct radix_cache_entry *)malloc(sizeof(struct radix_cache_entry) + (power_length + 2) * sizeof(uint32_t));
+		check_memory_ptr(entry);
+		if (limbs_reciprocal(entry->limbs, &entry->length, power, power_length) == FAILURE)
+		{
+			free(entry);
+			return NULL;
+		}
+		entry = cache_publish(&reciprocals[radix][k], entry);
 	}
-	number->first->prev = current;
-	current->next = number->first;
-	number->first = temp;
-	return SUCCESS;
+
+	*length = entry->length;
+	return entry->limbs;
 }
 
-int bigint_shift_left_basic(bigint number)
+// Read entry of shared cache; it is either NULL or completely filled by the thread that published it
+struct radix_cache_entry *cache_load(struct radix_cache_entry **slot)
 {
+#if defined(BUILTIN_ATOMICS)
+	return __atomic_load_n(slot, __ATOMIC_ACQUIRE);
+#elif defined(MSVC_ATOMICS)
+	return (struct radix_cache_entry *)_InterlockedCompareExchangePointer((void *volatile *)slot, NULL, NULL);
+#else
+	return *slot;
+#endif
+}
 
-	// Wrong argument passed to function
-	if (number == NULL)
+// Publish entry in shared cache; if another thread was first, its entry is returned and this one is released
+struct radix_cache_entry *cache_publish(struct radix_cache_entry **slot, struct radix_cache_entry *entry)
+{
+	struct radix_cache_entry *expected = NULL;
+#if defined(BUILTIN_ATOMICS)
+	__atomic_compare_exchange_n(slot, &expected, entry, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#elif defined(MSVC_ATOMICS)
+	expected = (struct radix_cache_entry *)_InterlockedCompareExchangePointer((void *volatile *)slot, entry, NULL);
+#else
+	*slot = entry;
+#endif
+	if (expected != NULL)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		free(entry);
+		return expected;
 	}
+	return entry;
+}
 
-	// In case new segment needs to be added
-	if (number->last->value & 0x80000000)
-	{
-		number->last->next = (bigint_node *)malloc(sizeof(bigint_node));
-		check_memory_int(number->last->next);
-		initialise_node(number->last->next);
-		number->last->next->prev = number->last;
-		number->last = number->last->next;
-		number->length += 1;
-		number->last->value = 0;
+// Choose k, so that the number is split by chunk base raised to 2^k; digits is the required number of digits or 0
+size_t radix_split(uint32_t *limbs, size_t length, int radix, size_t digits)
+{
+	size_t chunk_digits = 0, k = 0;
+	uint32_t chunk_base = radix_chunk_base(radix, &chunk_digits);
+	if (digits == 0)
+	{
+		// Number has at least (bits - 1) / log2(radix) digits and log2(chunk base) <= bit length of chunk base
+		size_t bits = 32 * (length - 1) + bit_len(limbs[length - 1]);
+		size_t lower_digits = (bits - 1) * chunk_digits / bit_len(chunk_base);
+		while (chunk_digits << (k + 1) <= lower_digits)
+		{
+			k++;
+		}
 	}
-
-	uint32_t remaining1 = 0;
-	uint32_t remaining2 = 0;
-	size_t i = 0;
-	bigint_node *current = number->first;
-	for (i = 0; i < number->length; i++)
+	else
 	{
-		remaining1 = (current->value & 0x80000000) >> 31;
-		current->value = (current->value << 1) | remaining2;
-		remaining2 = remaining1;
-		current = current->next;
+		while (chunk_digits << (k + 1) < digits)
+		{
+			k++;
+		}
 	}
 
-	return SUCCESS;
+	return k;
 }
 
-int bigint_shift_left(bigint number, size_t count)
+// Write digits of limbs in given base to buffer; limbs are overwritten
+// If digits is 0 leading zeros are omitted, otherwise exactly digits characters are written
+// Long numbers are split by chunk base raised to 2^k and both parts are converted separately
+int limbs_to_radix(uint32_t *limbs, size_t length, int radix, char *buffer, size_t digits, size_t *written, int threads)
 {
-	if (number == NULL)
-	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
-	}
-	if (count == 0)
+	length = limbs_normalize(limbs, length);
+	size_t chunk_digits = 0, position = 0;
+	uint32_t chunk_base = radix_chunk_base(radix, &chunk_digits);
+
+	// Short numbers: divide by chunk base as long as something is left
+	if (length <= RADIX_OUTPUT_THRESHOLD || digits == chunk_digits)
 	{
+		char temp[RADIX_OUTPUT_THRESHOLD * 32 + 32];
+		char *end = (digits == 0 ? temp + sizeof(temp) : buffer + digits);
+		char *current = end;
+		while (length > 0)
+		{
+			current -= chunk_digits;
+			write_radix_chunk(current, limbs_divide_1(limbs, limbs, length, chunk_base), radix, chunk_digits);
+			length = limbs_normalize(limbs, length);
+		}
+		if (digits != 0)
+		{
+			memset(buffer, '0', (size_t)(current - buffer));
+			*written = digits;
+			return SUCCESS;
+		}
+		while (current < end - 1 && *current == '0')
+		{
+			current++;
+		}
+		if (current == end)
+		{
+			*(--current) = '0';
+		}
+		*written = (size_t)(end - current);
+		memcpy(buffer, current, *written);
 		return SUCCESS;
 	}
-	size_t segments = count / 32;
-	size_t bits = count % 32;
-	size_t i = 0;
-	int result = SUCCESS;
-	if (add_segments_beginning(number, segments) == FAILURE)
+
+	// Choose power of chunk base not greater than the number or split required number of digits in halves
+	size_t k = radix_split(limbs, length, radix, digits);
+	size_t power_length = 0, reciprocal_length = 0;
+	uint32_t *power = radix_power(radix, k, &power_length);
+	check_memory_int(power);
+	uint32_t *reciprocal = radix_reciprocal(radix, k, &reciprocal_length);
+	check_memory_int(reciprocal);
+
+	uint32_t *quotient = (uint32_t *)malloc((length + 3 + power_length) * sizeof(uint32_t));
+	check_memory_int(quotient);
+	uint32_t *remainder = quotient + length + 3;
+	size_t quotient_length = 0, remainder_length = 0;
+	int status = limbs_divide_reciprocal(quotient, &quotient_length, remainder, &remainder_length, limbs, length, power, power_length, reciprocal, reciprocal_length);
+
+	// Low part may be converted by another thread; its place is unknown until the high part is written, so it gets own buffer
+	struct conversion_task task;
+	memset(&task, 0, sizeof(struct conversion_task));
+	task.function = task_limbs_to_radix;
+	task.radix = radix;
+	task.limbs = remainder;
+	task.length = remainder_length;
+	task.digits = chunk_digits << k;
+	task.threads = threads / 2;
+	if (status == SUCCESS && threads > 1 && length >= PARALLEL_CONVERSION_THRESHOLD)
+	{
+		task.buffer = (char *)malloc(task.digits);
+		if (task.buffer != NULL)
+		{
+			task_start(&task, TRUE);
+		}
+	}
+
+	// High part followed by low part with exactly chunk_digits * 2^k digits
+	if (status == SUCCESS)
 	{
-		return FAILURE;
+		status = limbs_to_radix(quotient, quotient_length, radix, buffer, (digits == 0 ? 0 : digits - (chunk_digits << k)), &position, threads - threads / 2);
 	}
-	for (i = 0; i < bits; i++)
+	if (task.buffer != NULL)
 	{
-		result = bigint_shift_left_basic(number);
-		if (result == FAILURE)
+		if (task_finish(&task) == FAILURE)
 		{
-			return FAILURE;
+			status = FAILURE;
 		}
+		if (status == SUCCESS)
+		{
+			memcpy(buffer + position, task.buffer, task.digits);
+			*written = position + task.digits;
+		}
+		free(task.buffer);
 	}
-	return SUCCESS;
+	else if (status == SUCCESS)
+	{
+		status = limbs_to_radix(remainder, remainder_length, radix, buffer + position, chunk_digits << k, written, threads);
+		*written += position;
+	}
+
+	free(quotient);
+	return status;
 }
 
-int bigint_shift_right_basic(bigint number)
+// Write digits of number in base 2^bits without leading zeros and return their count
+size_t write_power_of_two_digits(bigint number, char *buffer, unsigned int bits, const char *characters)
 {
-	// Wrong arguments
-	if (number == NULL)
+	size_t total = 32 * (number->length - 1) + bit_len(number->last->value);
+	size_t count = (total == 0 ? 1 : (total + bits - 1) / bits);
+	uint32_t mask = ((uint32_t)1 << bits) - 1;
+	uint64_t accumulator = 0;
+	unsigned int filled = 0;
+	size_t position = count, i = 0;
+	bigint_node *current = number->first;
+
+	// Digits are written from the least significant one, limbs are taken when needed
+	while (position > 0)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		if (filled < bits && i < number->length)
+		{
+			accumulator |= (uint64_t)current->value << filled;
+			filled += 32;
+			current = current->next;
+			i++;
+		}
+		buffer[--position] = characters[accumulator & mask];
+		accumulator >>= bits;
+		filled = (filled > bits ? filled - bits : 0);
 	}
 
-	uint32_t remaining1 = 0;
-	uint32_t remaining2 = 0;
-	size_t i = 0;
-	bigint_node *current = number->last;
-	for (i = 0; i < number->length; i++)
-	{
-		remaining1 = (current->value & 1) << 31;
-		current->value = (current->value >> 1) | remaining2;
-		remaining2 = remaining1;
-		current = current->prev;
-	}
+	return count;
+}
 
-	// Delete last segment
-	bigint_node *temp_ptr = number->last;
-	if (temp_ptr->value == 0 && number->length != 1)
+// Pass collected characters to the writer
+int output_flush(struct radix_output *output)
+{
+	if (output->position > 0 && output->writer(output->buffer, output->position, output->context) != 0)
 	{
-		number->last->prev->next = NULL;
-		number->last = number->last->prev;
-		free(temp_ptr);
-		number->length -= 1;
+		bigint_errno = BIGINT_WRITE_ERROR;
+		return FAILURE;
 	}
 
+	output->position = 0;
 	return SUCCESS;
 }
 
-int bigint_not(bigint number)
+// Append characters to the output; if data is NULL, count copies of '0' are appended
+int output_append(struct radix_output *output, const char *data, size_t count)
 {
-	// Wrong arguments
-	if (number == NULL)
+	size_t part = 0;
+	while (count > 0)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
-	}
-	bigint_node *current = number->first;
-	size_t i = 0;
-	for (i = 0; i < number->length; i++)
-	{
-		current->value = ~(current->value);
-		current = current->next;
+		if (output->position == WRITE_BUFFER_SIZE && output_flush(output) == FAILURE)
+		{
+			return FAILURE;
+		}
+		part = (count < WRITE_BUFFER_SIZE - output->position ? count : WRITE_BUFFER_SIZE - output->position);
+		if (data == NULL)
+		{
+			memset(output->buffer + output->position, '0', part);
+		}
+		else
+		{
+			memcpy(output->buffer + output->position, data, part);
+			data += part;
+		}
+		output->position += part;
+		count -= part;
 	}
+
 	return SUCCESS;
 }
 
-int bigint_shift_right(bigint number, size_t count)
+// Like limbs_to_radix(), but digits are passed to the output, the most significant first
+// Limbs are released as soon as they are divided, so the working set shrinks while digits are written
+int limbs_stream_radix(uint32_t *limbs, size_t length, int radix, size_t digits, struct radix_output *output)
 {
-	if (number == NULL)
+	length = limbs_normalize(limbs, length);
+	size_t chunk_digits = 0, written = 0;
+	radix_chunk_base(radix, &chunk_digits);
+	int status = SUCCESS;
+
+	// Short numbers fit the temporary buffer, missing leading zeros are written separately
+	if (length <= RADIX_OUTPUT_THRESHOLD)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		char temp[RADIX_OUTPUT_THRESHOLD * 32 + 32];
+		size_t limit = sizeof(temp) / chunk_digits * chunk_digits;
+		size_t zeros = (digits > limit ? digits - limit : 0);
+		status = output_append(output, NULL, zeros);
+		if (status == SUCCESS)
+		{
+			status = limbs_to_radix(limbs, length, radix, temp, digits - zeros, &written, 1);
+		}
+		if (status == SUCCESS)
+		{
+			status = output_append(output, temp, written);
+		}
+		free(limbs);
+		return status;
+	}
+
+	size_t k = radix_split(limbs, length, radix, digits);
+	size_t power_length = 0, reciprocal_length = 0;
+	uint32_t *power = radix_power(radix, k, &power_length);
+	uint32_t *reciprocal = (power == NULL ? NULL : radix_reciprocal(radix, k, &reciprocal_length));
+	uint32_t *quotient = (uint32_t *)malloc((length + 3) * sizeof(uint32_t));
+	uint32_t *remainder = (uint32_t *)malloc(power_length * sizeof(uint32_t));
+	if (reciprocal == NULL || quotient == NULL || remainder == NULL)
+	{
+		free(limbs);
+		free(quotient);
+		free(remainder);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
 		return FAILURE;
 	}
-	if (count == 0)
+	size_t quotient_length = 0, remainder_length = 0;
+	status = limbs_divide_reciprocal(quotient, &quotient_length, remainder, &remainder_length, limbs, length, power, power_length, reciprocal, reciprocal_length);
+	free(limbs);
+	if (status == FAILURE)
 	{
-		return SUCCESS;
+		free(quotient);
+		free(remainder);
+		return FAILURE;
+	}
+
+	// High part followed by low part with exactly chunk_digits * 2^k digits
+	status = limbs_stream_radix(quotient, quotient_length, radix, (digits == 0 ? 0 : digits - (chunk_digits << k)), output);
+	if (status == FAILURE)
+	{
+		free(remainder);
+		return FAILURE;
 	}
+	return limbs_stream_radix(remainder, remainder_length, radix, chunk_digits << k, output);
+}
+
+// Pass digits of number in base 2^bits to the output starting from the most significant one
+int stream_power_of_two_digits(bigint number, unsigned int bits, const char *characters, struct radix_output *output)
+{
+	size_t total = 32 * (number->length - 1) + bit_len(number->last->value);
+	size_t count = (total == 0 ? 1 : (total + bits - 1) / bits);
+	unsigned int width = (unsigned int)(total - (count - 1) * bits);
+	uint64_t accumulator = number->last->value;
+	unsigned int filled = (unsigned int)bit_len(number->last->value);
+	bigint_node *current = number->last->prev;
+	char digit = 0;
 	size_t i = 0;
-	int result = SUCCESS;
+
+	// The first digit may be shorter, limbs are taken from the most significant one when needed
 	for (i = 0; i < count; i++)
 	{
-		result = bigint_shift_right_basic(number);
-		if (result == FAILURE)
+		if (filled < width)
+		{
+			accumulator = (accumulator << 32) | current->value;
+			filled += 32;
+			current = current->prev;
+		}
+		filled -= width;
+		digit = characters[(accumulator >> filled) & (((uint32_t)1 << width) - 1)];
+		if (output_append(output, &digit, 1) == FAILURE)
 		{
 			return FAILURE;
 		}
+		width = bits;
 	}
+
 	return SUCCESS;
 }
 
-int bigint_compare_absolute(bigint number1, bigint number2)
+// Write sign, prefix and digits of number to the writer through a buffer of constant size
+int stream_string(bigint_writer writer, void *context, int radix, const char *prefix, bigint number)
 {
+	struct radix_output *output = (struct radix_output *)malloc(sizeof(struct radix_output));
+	check_memory_int(output);
+	output->writer = writer;
+	output->context = context;
+	output->position = 0;
 
-	// Wrong arguments passed to function
-	if (number1 == NULL || number2 == NULL)
+	int status = SUCCESS;
+	if (number->sign == NEGATIVE)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		status = output_append(output, "-", 1);
+	}
+	if (status == SUCCESS)
+	{
+		status = output_append(output, prefix, strlen(prefix));
 	}
 
-	if (number1->length != number2->length)
+	if (status == SUCCESS && (radix & (radix - 1)) == 0)
 	{
-		return (number1->length > number2->length ? 1 : -1);
+		status = stream_power_of_two_digits(number, (unsigned int)bit_len((uint32_t)radix) - 1, digit_characters(radix), output);
+	}
+	else if (status == SUCCESS)
+	{
+		size_t length = 0;
+		uint32_t *limbs = copy_to_limbs(number, &length);
+		status = (limbs == NULL ? FAILURE : limbs_stream_radix(limbs, length, radix, 0, output));
+	}
+	if (status == SUCCESS)
+	{
+		status = output_flush(output);
 	}
 
-	size_t i = 0;
-	bigint_node *current1 = number1->last;
-	bigint_node *current2 = number2->last;
-	for (i = 0; i < number1->length; i++)
+	free(output);
+	return status;
+}
+
+// Writer passing characters to the stream given as context
+int write_file(const char *data, size_t length, void *context)
+{
+	return (fwrite(data, 1, length, (FILE *)context) == length ? SUCCESS : FAILURE);
+}
+
+// Upper bound of number of digits in given base
+size_t digits_bound(bigint number, int radix)
+{
+	size_t bits = 32 * (number->length - 1) + bit_len(number->last->value);
+	if (bits == 0)
 	{
-		if (current1->value != current2->value)
+		return 1;
+	}
+	if ((radix & (radix - 1)) == 0)
+	{
+		size_t radix_bits = bit_len((uint32_t)radix) - 1;
+		return (bits + radix_bits - 1) / radix_bits;
+	}
+	if (radix == 10)
+	{
+		// log10(2) is slightly overestimated
+		return (size_t)((double)bits * 0.30103) + 2;
+	}
+
+	// log2(chunk base) > bit length of chunk base - 1
+	size_t chunk_digits = 0;
+	uint32_t chunk_base = radix_chunk_base(radix, &chunk_digits);
+	return bits * chunk_digits / (bit_len(chunk_base) - 1) + 1;
+}
+
+// Write sign, prefix and digits of number followed by null character; used by bigint_to_string() and bigint_to_string_radix()
+size_t write_string(char *buffer, size_t capacity, int radix, const char *prefix, bigint number)
+{
+	// Exact number of digits in other bases than powers of two is known after conversion, so a small buffer may still be enough
+	size_t prefix_length = strlen(prefix);
+	size_t size = (number->sign == NEGATIVE ? 1 : 0) + prefix_length + digits_bound(number, radix) + 1;
+	int power_of_two = ((radix & (radix - 1)) == 0);
+	char *output = buffer;
+	if (size > capacity)
+	{
+		if (power_of_two)
 		{
-			return (current1->value > current2->value ? 1 : -1);
+			bigint_errno = BIGINT_BUFFER_TOO_SMALL;
+			return 0;
+		}
+		output = (char *)malloc(size);
+		if (output == NULL)
+		{
+			bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+			return 0;
 		}
-		current1 = current1->prev;
-		current2 = current2->prev;
 	}
-	return 0;
+
+	size_t position = 0;
+	if (number->sign == NEGATIVE)
+	{
+		output[position++] = '-';
+	}
+	memcpy(output + position, prefix, prefix_length);
+	position += prefix_length;
+
+	if (power_of_two)
+	{
+		position += write_power_of_two_digits(number, output + position, (unsigned int)bit_len((uint32_t)radix) - 1, digit_characters(radix));
+	}
+	else
+	{
+		size_t length = 0, written = 0;
+		uint32_t *limbs = copy_to_limbs(number, &length);
+		int status = (limbs == NULL ? FAILURE : limbs_to_radix(limbs, length, radix, output + position, 0, &written, conversion_threads(length)));
+		free(limbs);
+		if (status == FAILURE)
+		{
+			if (output != buffer)
+			{
+				free(output);
+			}
+			return 0;
+		}
+		position += written;
+	}
+	output[position] = '\0';
+
+	if (output != buffer)
+	{
+		if (position + 1 > capacity)
+		{
+			free(output);
+			bigint_errno = BIGINT_BUFFER_TOO_SMALL;
+			return 0;
+		}
+		memcpy(buffer, output, position + 1);
+		free(output);
+	}
+
+	return position;
 }
 
-int bigint_compare(bigint number1, bigint number2)
+size_t bigint_string_size(bigint number, bigint_base base)
 {
 
 	// Wrong arguments passed to function
-	if (number1 == NULL || number2 == NULL)
+	if ((base != BIN && base != DEC && base != HEX) || number == NULL || number->last == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return 0;
 	}
 
-	switch (2 * number1->sign + number2->sign)
+	// Sign, prefix, digits and null character
+	return (number->sign == NEGATIVE ? 1 : 0) + (base == DEC ? 0 : 2) + digits_bound(number, base_radixes[base]) + 1;
+}
+
+size_t bigint_string_size_radix(bigint number, int radix)
+{
+
+	// Wrong arguments passed to function
+	if (radix < 2 || radix > MAX_RADIX || number == NULL || number->last == NULL)
 	{
-	case 0:
-		// Both numbers positive
-		return bigint_compare_absolute(number1, number2);
-	case 1:
-		// number1 positive, number2 negative
-		return 1;
-	case 2:
-		// number1 negative, number2 positive
-		return -1;
-	case 3:
-		// Both numbers negative
-		return bigint_compare_absolute(number2, number1);
-	default:
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return 0;
 	}
+
+	// Sign, digits and null character
+	return (number->sign == NEGATIVE ? 1 : 0) + digits_bound(number, radix) + 1;
 }
 
-bigint bigint_copy(bigint number)
+size_t bigint_to_string(char *buffer, size_t capacity, bigint_base base, bigint number)
 {
-	// Wrong argument passed to function
-	if (number == NULL)
+
+	// Wrong arguments passed to function
+	if (buffer == NULL || (base != BIN && base != DEC && base != HEX) || number == NULL || number->last == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return NULL;
-	}
-	bigint return_number = bigint_create_empty_segments(number->length);
-	return_number->length = number->length;
-	return_number->sign = number->sign;
-	bigint_node *current1 = return_number->first;
-	bigint_node *current2 = number->first;
-	size_t i = 0;
-	for (i = 0; i < number->length; i++)
-	{
-		current1->value = current2->value;
-		current1 = current1->next;
-		current2 = current2->next;
+		return 0;
 	}
-	return return_number;
+
+	char *prefixes[] = {"0b", "", "0x"};
+	return write_string(buffer, capacity, base_radixes[base], prefixes[base], number);
 }
 
-int bigint_add_basic(bigint sum, bigint _summand1, bigint _summand2)
+size_t bigint_to_string_radix(char *buffer, size_t capacity, int radix, bigint number)
 {
+
 	// Wrong arguments passed to function
-	if (sum == NULL || _summand1 == NULL || _summand2 == NULL)
+	if (buffer == NULL || radix < 2 || radix > MAX_RADIX || number == NULL || number->last == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		return 0;
 	}
 
-	// Just in case sum and summand 1/2 is the same number
-	bigint summand1 = bigint_copy(_summand1);
-	bigint summand2 = bigint_copy(_summand2);
+	return write_string(buffer, capacity, radix, "", number);
+}
 
-	bigint longer = (summand1->length > summand2->length ? summand1 : summand2);
-	bigint shorter = (summand1->length > summand2->length ? summand2 : summand1);
+int bigint_print(FILE *stream, bigint_base base, bigint number)
+{
 
-	// Empty sum
-	reset(sum);
-	if (sum->length < longer->length + 1)
+	// Wrong arguments passed to function
+	if (stream == NULL || (base != BIN && base != DEC && base != HEX) || number == NULL || number->last == NULL)
 	{
-		add_segments(sum, longer->length + 1 - sum->length);
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	bigint_node empty_node = {0, NULL, NULL};
-	empty_node.next = &empty_node;
-	uint64_t integer_sum = 0;
-	uint32_t temp = 0;
-	size_t i = 0;
-	bigint_node *current_sum = sum->first;
-	bigint_node *current_longer = longer->first;
-	bigint_node *current_shorter = shorter->first;
-	uint32_t *int_ptr = (uint32_t *)&integer_sum;
-	int endianness = check_endian();
-
-	for (i = 0; i <= longer->length; i++)
-	{
-		integer_sum = (uint64_t)(current_longer->value) + (uint64_t)(current_shorter->value) + (uint64_t)temp;
-		if (endianness == -1)
-		{
-			// Little endian
-			current_sum->value = int_ptr[0];
-			temp = int_ptr[1];
-		}
-		else
-		{
-			// Big endian
-			current_sum->value = int_ptr[1];
-			temp = int_ptr[0];
-		}
+	// Digits are written in pieces as they are converted
+	char *prefixes[] = {"0b", "", "0x"};
+	return stream_string(write_file, stream, base_radixes[base], prefixes[base], number);
+}
 
-		current_sum = current_sum->next;
-		current_shorter = (current_shorter->next == NULL ? &empty_node : current_shorter->next);
-		current_longer = (current_longer->next == NULL ? &empty_node : current_longer->next);
-	}
+int bigint_write(FILE *stream, int radix, bigint number)
+{
 
-	bigint_node *temp_ptr = NULL;
-	while (sum->last->value == 0 && sum->length != 1)
+	// Wrong arguments passed to function
+	if (stream == NULL || radix < 2 || radix > MAX_RADIX || number == NULL || number->last == NULL)
 	{
-		temp_ptr = sum->last;
-		sum->last->prev->next = NULL;
-		sum->last = sum->last->prev;
-		if (temp_ptr)
-		{
-			free(temp_ptr);
-			temp_ptr = NULL;
-		}
-		sum->length -= 1;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	bigint_release_basic(summand1);
-	bigint_release_basic(summand2);
-
-	return SUCCESS;
+	return stream_string(write_file, stream, radix, "", number);
 }
 
-int bigint_add_sign(bigint sum, bigint summand1, bigint summand2)
+int bigint_write_callback(bigint_writer writer, void *context, int radix, bigint number)
 {
-	// Wrong arguments
-	if (sum == NULL || summand1 == NULL || summand2 == NULL)
+
+	// Wrong arguments passed to function
+	if (writer == NULL || radix < 2 || radix > MAX_RADIX || number == NULL || number->last == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
-	int result = 0;
-	int comparison = 0;
-	switch (2 * summand1->sign + summand2->sign)
-	{
-	case 0:
-		// Both numbers positive
-		return bigint_add_basic(sum, summand1, summand2);
-	case 1:
-	case 2:
-		// Different sign
-		comparison = bigint_compare_absolute(summand1, summand2);
-		bigint bigger = (comparison == 1 ? summand1 : summand2);
-		bigint smaller = (comparison == 1 ? summand2 : summand1);
-		result = bigint_subtract_basic(sum, bigger, smaller);
-		sum->sign = (comparison == 0 ? 0 : bigger->sign);
-		return result;
-	case 3:
-		// Both numbers negative
-		result = bigint_add_basic(sum, summand1, summand2);
-		sum->sign = 1;
-		return result;
-	default:
-		return FAILURE;
-	}
+
+	return stream_string(writer, context, radix, "", number);
 }
 
-int bigint_add(int args, bigint sum, ...)
+int bigint_release_basic(bigint number)
 {
 
-	va_list ap;
-	va_start(ap, sum);
-
-	// Wrong arguments
-	if (args <= 0 || sum == NULL)
+	// Wrong arguments passed to function
+	if (number == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	// In case sum is also one of summands
-	bigint temp_sum = bigint_create("0", 1);
-
-	int status = SUCCESS;
-	int i = 0;
-	for (i = 0; i < args; i++)
+	bigint_node *current = number->first;
+	bigint_node *previous = NULL;
+	size_t i = 0;
+	for (i = 0; i < number->length; i++)
 	{
-		status = bigint_add_sign(temp_sum, temp_sum, va_arg(ap, bigint));
-		if (status == FAILURE)
-		{
-			return status;
-		}
+		previous = current;
+		current = current->next;
+		free(previous);
 	}
-	va_end(ap);
 
-	bigint_release_segments(sum);
-	sum->length = temp_sum->length;
-	sum->first = temp_sum->first;
-	sum->last = temp_sum->last;
-	sum->sign = temp_sum->sign;
-	free(temp_sum);
+	free(number);
+
+	// current should be null
+	if (current != NULL)
+	{
+		bigint_errno = BIGINT_ERROR_IN_DATA_STRUCTURE;
+		return FAILURE;
+	}
 
 	return SUCCESS;
 }
 
-int bigint_increment_basic(bigint number)
+int bigint_release_segments(bigint number)
 {
-	// Wrong arguments
+
+	// Wrong arguments passed to function
 	if (number == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
-	// In case we need to add new segment
-	add_segments(number, 1);
-	size_t i = 0;
+
 	bigint_node *current = number->first;
+	bigint_node *previous = NULL;
+	size_t i = 0;
 	for (i = 0; i < number->length; i++)
 	{
-		if (~(current->value) == 0)
-		{
-			current->value += 1;
-		}
-		else
-		{
-			current->value += 1;
-			break;
-		}
+		previous = current;
 		current = current->next;
+		free(previous);
 	}
-	if (number->last->value == 0 && number->length != 1)
+
+	// current should be null
+	if (current != NULL)
 	{
-		bigint_node *temp = number->last;
-		number->last->prev->next = NULL;
-		number->last = number->last->prev;
-		free(temp);
-		number->length -= 1;
+		bigint_errno = BIGINT_ERROR_IN_DATA_STRUCTURE;
+		return FAILURE;
 	}
+
 	return SUCCESS;
 }
 
-int bigint_increment(bigint number)
+int bigint_release(int count, ...)
 {
 	// Wrong argument
-	if (number == NULL)
+	if (count < 0)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
-	if (number->sign == 0)
+	else if (count == 0)
 	{
-		// positive
-		bigint_increment_basic(number);
+		return SUCCESS;
 	}
-	else
+
+	va_list ap;
+	va_start(ap, count);
+	int status = SUCCESS;
+	int i = 0;
+	for (i = 0; i < count; i++)
 	{
-		// negative
-		bigint_decrement_basic(number);
-		// change sign if necessary
-		if (number->length == 1 && number->first->value == 0)
+		status = bigint_release_basic(va_arg(ap, bigint));
+		if (status == FAILURE)
 		{
-			number->sign = 0;
+			return status;
 		}
 	}
+	va_end(ap);
+
 	return SUCCESS;
 }
 
-int bigint_subtract_basic(bigint difference, bigint minuend, bigint subtrahend)
+size_t bigint_size(bigint number)
 {
-	// Main idea:
-	// x - y = x + ~y + 1
-
-	// Make sure minuend and subtrahend have the same length
-	bigint adjusted = bigint_create_empty_segments(minuend->length);
-	size_t i = 0;
-	bigint_node *current1 = subtrahend->first;
-	bigint_node *current2 = adjusted->first;
-	for (i = 0; i < subtrahend->length; i++)
+	// Wrong arguments passed to function
+	if (number == NULL)
 	{
-		current2->value = ~(current1->value);
-		current1 = current1->next;
-		current2 = current2->next;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
-	for (i = subtrahend->length; i < minuend->length; i++)
+
+	return sizeof(struct bigint_data_structure) + (number->length * sizeof(bigint_node));
+}
+
+int bigint_get_sign(bigint number)
+{
+
+	// Wrong argument passed to function
+	if (number == NULL)
 	{
-		current2->value = ~(uint32_t)0;
-		current2 = current2->next;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
-	bigint_add_basic(difference, minuend, adjusted);
-	bigint_increment_basic(difference);
+	return number->sign;
+}
 
-	// Delete last segment
-	difference->length -= 1;
-	difference->last->prev->next = NULL;
-	bigint_node *temp = difference->last;
-	difference->last = temp->prev;
-	free(temp);
+int bigint_absolute_value(bigint number)
+{
 
-	// Delete segments filled with zeros
-	bigint_node *temp_ptr = NULL;
-	while (difference->last->value == 0 && difference->length != 1)
+	// Wrong argument passed to funcion
+	if (number == NULL)
 	{
-		temp_ptr = difference->last;
-		difference->last->prev->next = NULL;
-		difference->last = difference->last->prev;
-		free(temp_ptr);
-		difference->length -= 1;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
 
+	number->sign = 0;
+
 	return SUCCESS;
 }
 
-int bigint_subtract(bigint difference, bigint minuend, bigint subtrahend)
+int bigint_change_sign(bigint number)
 {
-	// Wrong arguments
-	if (difference == NULL || minuend == NULL || subtrahend == NULL)
+
+	// Wrong argument passed to function
+	if (number == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	bigint bigger, smaller;
-	int result = 0;
-	int comparison = 0;
-	switch (2 * minuend->sign + subtrahend->sign)
+	// Zero stays positive
+	if (number->length != 1 || number->first->value != 0)
 	{
-	case 0:
-		// Both numbers positive
-		comparison = bigint_compare_absolute(minuend, subtrahend);
-		bigger = (comparison == 1 ? minuend : subtrahend);
-		smaller = (comparison == 1 ? subtrahend : minuend);
-		result = bigint_subtract_basic(difference, bigger, smaller);
-		difference->sign = (comparison == 0 ? 0 : (subtrahend == bigger ? 1 : 0));
-		return result;
-	case 1:
-		// minuend positive, subtrahend negative
-		result = bigint_add_basic(difference, minuend, subtrahend);
-		difference->sign = 0;
-		return result;
-	case 2:
-		// minuend negative, subtrahend positive
-		result = bigint_add_basic(difference, minuend, subtrahend);
-		difference->sign = 1;
-		return result;
-	case 3:
-		// Both numbers negative
-		comparison = bigint_compare_absolute(minuend, subtrahend);
-		bigger = (comparison == 1 ? minuend : subtrahend);
-		smaller = (comparison == 1 ? subtrahend : minuend);
-		result = bigint_subtract_basic(difference, bigger, smaller);
-		difference->sign = (comparison != 1 ? 0 : 1);
-		return result;
+		number->sign = (number->sign == 1 ? 0 : 1);
 	}
 
 	return SUCCESS;
 }
 
-int bigint_decrement_basic(bigint number)
+int add_segments_beginning(bigint number, size_t count)
 {
 	// Wrong arguments
 	if (number == NULL)
@@ -1716,428 +2422,5084 @@ int bigint_decrement_basic(bigint number)
 		return FAILURE;
 	}
 
-	bigint ones = bigint_create_empty_segments(number->length);
-	bigint_not(ones);
-	bigint_add_basic(number, number, ones);
+	if (count == 0)
+	{
+		return SUCCESS;
+	}
+	number->length += count;
 
-	// Delete last segment
-	bigint_node *temp_ptr = number->last;
-	number->last->prev->next = NULL;
-	number->last = number->last->prev;
-	free(temp_ptr);
-	number->length -= 1;
-	bigint_release_basic(ones);
+	bigint_node *current = (bigint_node *)malloc(sizeof(bigint_node));
+	bigint_node *temp = current;
+	check_memory_int(current);
+	initialise_node(current);
+
+	size_t i = 0;
+	for (i = 0; i < count - 1; i++)
+	{
+		current->next = (bigint_node *)malloc(sizeof(bigint_node));
+		check_memory_int(current->next);
+		initialise_node(current->next);
+		current->next->prev = current;
+		current = current->next;
+	}
+	number->first->prev = current;
+	current->next = number->first;
+	number->first = temp;
 	return SUCCESS;
 }
 
-int bigint_decrement(bigint number)
+int bigint_shift_left(bigint number, size_t count)
 {
-	// Wrong argument
 	if (number == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
-	// In case zero passed to function
-	if (number->length == 1 && number->first->value == 0)
+
+	// Zero stays zero
+	if (count == 0 || (number->length == 1 && number->first->value == 0))
 	{
-		number->first->value += 1;
-		number->sign = 1;
 		return SUCCESS;
 	}
-	if (number->sign == 0)
-	{
-		// positive
-		bigint_decrement_basic(number);
-	}
-	else
-	{
-		// negative
-		bigint_increment_basic(number);
-	}
-	return SUCCESS;
-}
+	size_t segments = count / 32;
+	unsigned int bits = (unsigned int)(count % 32);
 
-int reset(bigint number)
-{
-	bigint_node *current = number->first;
-	while (current != NULL)
+	// Bits are moved between neighbouring segments in one pass from the most significant one
+	if (bits != 0)
 	{
-		current->value = 0;
-		current = current->next;
+		if ((number->last->value >> (32 - bits)) != 0 && add_segments(number, 1) == FAILURE)
+		{
+			return FAILURE;
+		}
+		bigint_node *current = number->last;
+		for (; current->prev != NULL; current = current->prev)
+		{
+			current->value = (current->value << bits) | (current->prev->value >> (32 - bits));
+		}
+		current->value <<= bits;
 	}
-	return SUCCESS;
+
+	// Whole segments are added at the beginning
+	return add_segments_beginning(number, segments);
 }
 
-int add_segments(bigint number, size_t count)
+int bigint_not(bigint number)
 {
-	if (count == 0)
+	// Wrong arguments
+	if (number == NULL)
 	{
-		return SUCCESS;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
-	number->length += count;
+	bigint_node *current = number->first;
 	size_t i = 0;
-	bigint_node *current = number->last;
-	for (i = 0; i < count; i++)
+	for (i = 0; i < number->length; i++)
 	{
-		current->next = (bigint_node *)malloc(sizeof(bigint_node));
-		check_memory_int(current->next);
-		initialise_node(current->next);
-		current->next->prev = current;
+		current->value = ~(current->value);
 		current = current->next;
 	}
-	number->last = current;
 	return SUCCESS;
 }
 
-int bigint_multiply_basic(bigint product, bigint _element1, bigint _element2)
+int bigint_shift_right(bigint number, size_t count)
 {
-
-	// Wrong arguments passed to function
-	if (product == NULL || _element1 == NULL || _element2 == NULL)
+	if (number == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
+	if (count == 0)
+	{
+		return SUCCESS;
+	}
+	size_t segments = count / 32;
+	unsigned int bits = (unsigned int)(count % 32);
 
-	// In case product and _element1 or _element2 is the same number
-	bigint element1 = bigint_copy(_element1);
-	bigint element2 = bigint_copy(_element2);
-
-	bigint longer = (bigint_compare_absolute(element1, element2) == 1 ? element1 : element2);
-	bigint shorter = (bigint_compare_absolute(element1, element2) == 1 ? element2 : element1);
-
-	reset(product);
-	bigint_release_segments(product);
-	product->length = 1;
-	product->first = (bigint_node *)malloc(sizeof(bigint_node));
-	check_memory_int(product->first);
-	initialise_node(product->first);
-	product->last = product->first;
+	// All bits are shifted out
+	if (segments >= number->length)
+	{
+		return set_u64(number, 0, POSITIVE);
+	}
 
-	bigint temp = NULL;
-	size_t counter = 0;
+	// Whole segments are removed from the beginning
+	bigint_node *temp = NULL;
 	size_t i = 0;
-	size_t j = 0;
-	bigint_node *current = shorter->first;
-	for (i = 0; i < shorter->length; i++)
+	for (i = 0; i < segments; i++)
 	{
-		for (j = 0; j < 32; j++)
+		temp = number->first;
+		number->first = temp->next;
+		number->first->prev = NULL;
+		free(temp);
+		number->length -= 1;
+	}
+
+	// Bits are moved between neighbouring segments in one pass from the least significant one
+	if (bits != 0)
+	{
+		bigint_node *current = number->first;
+		for (; current->next != NULL; current = current->next)
 		{
-			if ((current->value & (1 << j)) != 0)
-			{
-				temp = bigint_copy(longer);
-				bigint_shift_left(temp, counter);
-				bigint_add_basic(product, product, temp);
-				bigint_release_basic(temp);
-			}
-			counter += 1;
+			current->value = (current->value >> bits) | (current->next->value << (32 - bits));
+		}
+		current->value >>= bits;
+		if (current->value == 0 && number->length != 1)
+		{
+			resize_segments(number, number->length - 1);
 		}
-		current = current->next;
 	}
 
-	bigint_release_basic(element1);
-	bigint_release_basic(element2);
+	// Zero cannot be negative
+	if (number->length == 1 && number->first->value == 0)
+	{
+		number->sign = POSITIVE;
+	}
 
 	return SUCCESS;
 }
 
-int bigint_multiply(int count, bigint product, ...)
+int bigint_mul_2exp(bigint result, bigint number, size_t count)
 {
 
-	va_list ap;
-	va_start(ap, product);
-
-	// Wrong arguments
-	if (count <= 0 || product == NULL)
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL || number->first == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	// In case product appears as factor
-	bigint temp_product = bigint_create("1", 1);
-
-	int status = SUCCESS;
-	int i = 0;
-	uint8_t sign = 0;
-	bigint current = NULL;
-	for (i = 0; i < count; i++)
+	// Segments are placed after count / 32 zeros and shifted in place
+	size_t segments = count / 32, length = number->length, i = 0;
+	uint32_t *limbs = (uint32_t *)calloc(segments + length + 1, sizeof(uint32_t));
+	check_memory_int(limbs);
+	bigint_node *current = number->first;
+	for (i = 0; i < length; i++, current = current->next)
 	{
-		current = va_arg(ap, bigint);
-		status = bigint_multiply_basic(temp_product, temp_product, current);
-		if (status == FAILURE)
-		{
-			return status;
-		}
-		sign += current->sign;
+		limbs[segments + i] = current->value;
 	}
-	va_end(ap);
-
-	bigint_release_segments(product);
-	product->length = temp_product->length;
-	product->first = temp_product->first;
-	product->last = temp_product->last;
-	free(temp_product);
-	product->sign = sign % 2;
+	limbs[segments + length] = limbs_shift_left(limbs + segments, limbs + segments, length, (unsigned int)(count % 32));
 
-	return SUCCESS;
+	int status = save_limbs(result, limbs, segments + length + 1, number->sign);
+	free(limbs);
+	return status;
 }
 
-int leave_one_segment(bigint number)
+int bigint_tdiv_q_2exp(bigint result, bigint number, size_t count)
 {
-	// Wrong argument
-	if (number == NULL)
+
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL || number->first == NULL)
 	{
 		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
-	if (number->length == 1)
+
+	// Quotient is rounded towards zero, so it is the shifted absolute value
+	size_t segments = count / 32, i = 0;
+	if (segments >= number->length)
 	{
-		return SUCCESS;
+		return set_u64(result, 0, POSITIVE);
 	}
-	bigint_node *current = number->first->next;
-	bigint_node *previous = NULL;
-	size_t i = 0;
-	for (i = 1; i < number->length; i++)
+	size_t length = number->length - segments;
+	uint32_t *limbs = (uint32_t *)malloc(length * sizeof(uint32_t));
+	check_memory_int(limbs);
+	bigint_node *current = number->first;
+	for (i = 0; i < segments; i++)
 	{
-		previous = current;
 		current = current->next;
-		free(previous);
 	}
-	number->last = number->first;
-	number->length = 1;
-	number->first->value = 0;
-	return SUCCESS;
+	for (i = 0; i < length; i++, current = current->next)
+	{
+		limbs[i] = current->value;
+	}
+	limbs_shift_right(limbs, limbs, length, (unsigned int)(count % 32));
+
+	int status = save_limbs(result, limbs, length, number->sign);
+	free(limbs);
+	return status;
 }
 
-uint32_t *chain_alignment(bigint number, size_t length)
+int bigint_fdiv_r_2exp(bigint result, bigint number, size_t count)
 {
-	if (number->length > length)
+
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL || number->first == NULL)
 	{
-		return NULL;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
 	}
-	if (number == NULL)
+
+	// Remainder of floor division is never negative and has at most count bits
+	size_t length = (count + 31) / 32, i = 0;
+	if (length == 0)
 	{
-		return NULL;
+		return set_u64(result, 0, POSITIVE);
 	}
-	uint32_t *chain = (uint32_t *)malloc(length * sizeof(uint32_t));
-	memset(chain, 0, length * sizeof(uint32_t));
-	size_t shift = length - number->length;
-	bigint_node *current = number->last;
-	for (; shift < length; shift++)
+	uint32_t *limbs = (uint32_t *)calloc(length, sizeof(uint32_t));
+	check_memory_int(limbs);
+	bigint_node *current = number->first;
+	uint32_t any = 0;
+	for (i = 0; i < length && current != NULL; i++, current = current->next)
 	{
-		chain[shift] = current->value;
-		current = current->prev;
+		limbs[i] = current->value;
 	}
-	return chain;
-}
-
-int array_shift_left(uint32_t *array, size_t length)
-{
-	size_t i = length - 1;
-	uint32_t remaining1 = 0;
-	uint32_t remaining2 = 0;
-	for (; i != 0; i--)
+	if (count % 32 != 0)
 	{
-		remaining1 = (array[i] & 0x80000000) >> 31;
-		array[i] = (array[i] << 1) | remaining2;
-		remaining2 = remaining1;
+		limbs[length - 1] &= ((uint32_t)1 << (count % 32)) - 1;
 	}
-	array[i] = (array[i] << 1) | remaining2;
-	return SUCCESS;
-}
 
-// Length must be the same
-int array_subtract(uint32_t *array1, uint32_t *array2, size_t length)
-{
-	int i = 0;
-	uint64_t sum = 0;
-	uint32_t temp = 0;
-	uint32_t *sum_ptr = (uint32_t *)&sum;
-	int endianness = check_endian();
-	for (i = length - 1; i >= 0; i--)
+	// For negative numbers 2^count - (|number| mod 2^count) is computed as two's complement
+	for (i = 0; i < length; i++)
 	{
-		sum = (uint64_t)array1[i] + (uint64_t)(~array2[i]) + (uint64_t)temp;
-		if ((size_t)i == length - 1)
-		{
-			sum += 1;
-		}
-		if (endianness == -1)
+		any |= limbs[i];
+	}
+	if (number->sign == NEGATIVE && any != 0)
+	{
+		uint32_t carry = 1;
+		for (i = 0; i < length; i++)
 		{
-			// Little endian
-			array1[i] = sum_ptr[0];
-			temp = sum_ptr[1];
+			limbs[i] = ~limbs[i] + carry;
+			carry = (limbs[i] == 0 && carry == 1);
 		}
-		else
+		if (count % 32 != 0)
 		{
-			// Big endian
-			array1[i] = sum_ptr[1];
-			temp = sum_ptr[0];
+			limbs[length - 1] &= ((uint32_t)1 << (count % 32)) - 1;
 		}
 	}
-	return SUCCESS;
+
+	int status = save_limbs(result, limbs, length, POSITIVE);
+	free(limbs);
+	return status;
 }
 
-int greater_or_eq(uint32_t *array1, uint32_t *array2, size_t length)
+// Apply bitwise operation to two's complements of numbers given as absolute values and signs; result needs max(length1, length2) + 1 limbs
+// Negative operands and result are converted on the fly, carries of the conversions are kept between limbs
+uint8_t limbs_bitwise(uint32_t *result, uint32_t *limbs1, size_t length1, uint8_t sign1, uint32_t *limbs2, size_t length2, uint8_t sign2, int operation)
 {
-	size_t i = 0;
-	for (i = 0; i < length; i++)
+	size_t length = (length1 > length2 ? length1 : length2) + 1, i = 0;
+	uint8_t sign = 0;
+	switch (operation)
+	{
+	case BITWISE_AND:
+		sign = sign1 & sign2;
+		break;
+	case BITWISE_IOR:
+		sign = sign1 | sign2;
+		break;
+	case BITWISE_XOR:
+		sign = sign1 ^ sign2;
+		break;
+	default:
+		sign = sign1 & (sign2 ^ 1);
+		break;
+	}
+
+	// Both numbers non-negative: plain loops over common limbs
+	if (sign1 == POSITIVE && sign2 == POSITIVE)
 	{
-		if (array1[i] > array2[i])
+		size_t common = (length1 < length2 ? length1 : length2);
+		uint32_t *longer = (length1 > length2 ? limbs1 : limbs2);
+		switch (operation)
 		{
-			return 1;
+		case BITWISE_AND:
+			for (i = 0; i < common; i++)
+			{
+				result[i] = limbs1[i] & limbs2[i];
+			}
+			break;
+		case BITWISE_IOR:
+			for (i = 0; i < common; i++)
+			{
+				result[i] = limbs1[i] | limbs2[i];
+			}
+			break;
+		case BITWISE_XOR:
+			for (i = 0; i < common; i++)
+			{
+				result[i] = limbs1[i] ^ limbs2[i];
+			}
+			break;
+		default:
+			for (i = 0; i < common; i++)
+			{
+				result[i] = limbs1[i] & ~limbs2[i];
+			}
+			break;
 		}
-		else if (array1[i] < array2[i])
+
+		// Remaining limbs of the longer number are kept except for AND, or ANDNOT when the first number is shorter
+		for (i = common; i < length; i++)
 		{
-			return 0;
+			result[i] = (i < length - 1 && operation != BITWISE_AND && (operation != BITWISE_ANDNOT || length1 > length2) ? longer[i] : 0);
 		}
+		return POSITIVE;
 	}
-	return 1;
-}
 
-int bigint_divide(bigint dividend, bigint divisor, bigint quotient, bigint remainder)
-{
-
-	// Wrong arguments passed to function
-	if (dividend == NULL || divisor == NULL || (quotient == NULL && remainder == NULL))
+	uint32_t carry1 = sign1, carry2 = sign2, carry = sign;
+	uint32_t value1 = 0, value2 = 0, value = 0;
+	for (i = 0; i < length; i++)
 	{
-		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
-		return FAILURE;
+		value1 = (i < length1 ? limbs1[i] : 0);
+		value2 = (i < length2 ? limbs2[i] : 0);
+		if (sign1 == NEGATIVE)
+		{
+			value1 = ~value1 + carry1;
+			carry1 &= (value1 == 0);
+		}
+		if (sign2 == NEGATIVE)
+		{
+			value2 = ~value2 + carry2;
+			carry2 &= (value2 == 0);
+		}
+
+		switch (operation)
+		{
+		case BITWISE_AND:
+			value = value1 & value2;
+			break;
+		case BITWISE_IOR:
+			value = value1 | value2;
+			break;
+		case BITWISE_XOR:
+			value = value1 ^ value2;
+			break;
+		default:
+			value = value1 & ~value2;
+			break;
+		}
+
+		if (sign == NEGATIVE)
+		{
+			value = ~value + carry;
+			carry &= (value == 0);
+		}
+		result[i] = value;
 	}
 
-	// Division by zero
-	if (divisor->length == 1 && divisor->first->value == 0)
+	return sign;
+}
+
+// Common part of bigint_and(), bigint_ior(), bigint_xor() and bigint_andnot()
+int bigint_bitwise(bigint result, bigint number1, bigint number2, int operation)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || number1 == NULL || number2 == NULL || number1->first == NULL || number2->first == NULL)
 	{
-		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
 		return FAILURE;
 	}
 
-	// In case dividend and quotient are the same;
-	// Later on we change quotient's length
-	size_t initial_len = dividend->length;
+	size_t length1 = 0, length2 = 0;
+	uint32_t *limbs1 = copy_to_limbs(number1, &length1);
+	check_memory_int(limbs1);
+	uint32_t *limbs2 = copy_to_limbs(number2, &length2);
+	uint32_t *limbs = (uint32_t *)malloc(((length1 > length2 ? length1 : length2) + 1) * sizeof(uint32_t));
+	if (limbs2 == NULL || limbs == NULL)
+	{
+		free(limbs1);
+		free(limbs2);
+		free(limbs);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return FAILURE;
+	}
 
-	int comparison = bigint_compare_absolute(dividend, divisor);
+	uint8_t sign = limbs_bitwise(limbs, limbs1, length1, number1->sign, limbs2, length2, number2->sign, operation);
+	int status = save_limbs(result, limbs, (length1 > length2 ? length1 : length2) + 1, sign);
 
-	// Divisor is greater than dividend or divisor is equal to dividend
-	if (comparison == -1 || comparison == 0)
+	free(limbs1);
+	free(limbs2);
+	free(limbs);
+	return status;
+}
+
+int bigint_and(bigint result, bigint number1, bigint number2)
+{
+	return bigint_bitwise(result, number1, number2, BITWISE_AND);
+}
+
+int bigint_ior(bigint result, bigint number1, bigint number2)
+{
+	return bigint_bitwise(result, number1, number2, BITWISE_IOR);
+}
+
+int bigint_xor(bigint result, bigint number1, bigint number2)
+{
+	return bigint_bitwise(result, number1, number2, BITWISE_XOR);
+}
+
+int bigint_andnot(bigint result, bigint number1, bigint number2)
+{
+	return bigint_bitwise(result, number1, number2, BITWISE_ANDNOT);
+}
+
+// Node with given index; the list is walked from the nearer end
+bigint_node *node_at(bigint number, size_t index)
+{
+	bigint_node *current = NULL;
+	size_t i = 0;
+	if (index < number->length / 2)
 	{
-		if (quotient != NULL)
+		for (current = number->first; i < index; i++)
 		{
-			bigint_release_segments(quotient);
-			bigint_node *node = (bigint_node *)malloc(sizeof(bigint_node));
-			check_memory_int(node);
-			initialise_node(node);
-			if (comparison == 0)
-			{
-				node->value = 1;
-				quotient->sign = (dividend->sign == divisor->sign ? 0 : 1);
-			}
-			else
-			{
-				node->value = 0;
-				quotient->sign = 0;
-			}
-			quotient->length = 1;
-			quotient->first = quotient->last = node;
+			current = current->next;
 		}
-		if (remainder != NULL)
+	}
+	else
+	{
+		for (current = number->last, i = number->length - 1; i > index; i--)
 		{
-			bigint_release_segments(remainder);
-			if (comparison == 0)
-			{
-				bigint_node *node = (bigint_node *)malloc(sizeof(bigint_node));
-				check_memory_int(node);
-				initialise_node(node);
-				node->value = 0;
-				remainder->sign = 0;
-				remainder->length = 1;
-				remainder->first = remainder->last = node;
-			}
-			else
-			{
-				bigint temp = bigint_copy(dividend);
-				remainder->length = temp->length;
-				remainder->first = temp->first;
-				remainder->last = temp->last;
-				remainder->sign = temp->sign;
-				free(temp);
-			}
+			current = current->prev;
 		}
-		return SUCCESS;
 	}
 
-	size_t length = (initial_len) * sizeof(uint32_t);
-	uint32_t *remainder_int = (uint32_t *)malloc(length);
-	check_memory_int(remainder_int);
-	uint32_t *quotient_int = (uint32_t *)malloc(length);
-	check_memory_int(remainder_int);
-	memset(remainder_int, 0, length);
-	memset(quotient_int, 0, length);
+	return current;
+}
 
-	uint32_t *dividend_int = copy_to_chain(dividend);
-	uint32_t *divisor_int = chain_alignment(divisor, initial_len);
-	int i = (initial_len - 1) * sizeof(uint32_t) * 8 + bit_len(dividend_int[0]) - 1;
-	uint32_t bit = 0;
+// Carry of two's complement of negative number at segment with given index: 1 if all lower segments are zeros
+uint32_t complement_carry(bigint number, size_t index)
+{
+	size_t i = 0;
+	bigint_node *current = number->first;
+	for (i = 0; i < index && current != NULL; i++, current = current->next)
+	{
+		if (current->value != 0)
+		{
+			return 0;
+		}
+	}
 
-	for (; i >= 0; i--)
+	return 1;
+}
+
+// Add or subtract 1 from absolute value of number; used to move between negative number and its two's complement
+int magnitude_step(bigint number, int increase)
+{
+	bigint_node *current = number->first;
+	for (; current != NULL; current = current->next)
 	{
-		array_shift_left(remainder_int, initial_len);
-		bit = get_n_bit(dividend_int, initial_len, i);
-		if (bit)
+		if (increase)
 		{
-			remainder_int[initial_len - 1] |= 1;
+			if (++current->value != 0)
+			{
+				return SUCCESS;
+			}
 		}
-		if (greater_or_eq(remainder_int, divisor_int, initial_len))
+		else if (current->value-- != 0)
 		{
-			array_subtract(remainder_int, divisor_int, initial_len);
-			set_n_bit_to_1(quotient_int, initial_len, i);
+			break;
 		}
 	}
 
-	// Save result to quotient bigint structure
-	if (quotient != NULL)
+	// Carry goes to a new segment, borrow may leave the highest segment empty
+	if (increase)
 	{
-		size_t real_len = chain_length(quotient_int, initial_len);
-		real_len = (real_len != 0 ? real_len : 1);
-		leave_one_segment(quotient);
-		add_segments(quotient, real_len - 1);
-		size_t j = 0;
-		bigint_node *current = quotient->last;
-		for (j = 0; j < real_len; j++)
+		if (add_segments(number, 1) == FAILURE)
 		{
-			current->value = quotient_int[initial_len - real_len + j];
-			current = current->prev;
+			return FAILURE;
 		}
-		// Negative number division
-		if (dividend->sign + divisor->sign == 1)
+		number->last->value = 1;
+		return SUCCESS;
+	}
+	if (number->last->value == 0 && number->length != 1)
+	{
+		return resize_segments(number, number->length - 1);
+	}
+	return SUCCESS;
+}
+
+// Set, clear or flip bit of number treated as two's complement; bits of negative number are in the complement of its absolute value minus one
+int change_bit(bigint number, size_t index, int operation)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	uint8_t negative = (number->sign == NEGATIVE);
+	if (negative)
+	{
+		magnitude_step(number, FALSE);
+		operation = (operation == BIT_SET ? BIT_CLEAR : (operation == BIT_CLEAR ? BIT_SET : BIT_FLIP));
+	}
+
+	size_t segment = index / 32;
+	uint32_t mask = (uint32_t)1 << (index % 32);
+	int status = SUCCESS;
+	if (segment < number->length)
+	{
+		bigint_node *current = node_at(number, segment);
+		current->value = (operation == BIT_SET ? current->value | mask : (operation == BIT_CLEAR ? current->value & ~mask : current->value ^ mask));
+
+		// Highest segments may become zeros
+		bigint_node *last = number->last;
+		size_t length = number->length;
+		for (; length > 1 && last->value == 0; length--)
+		{
+			last = last->prev;
+		}
+		status = resize_segments(number, length);
+	}
+	else if (operation != BIT_CLEAR)
+	{
+		status = add_segments(number, segment + 1 - number->length);
+		if (status == SUCCESS)
 		{
-			quotient->sign = 1;
+			number->last->value = mask;
 		}
 	}
 
-	// save result to remainder bigint structure
-	if (remainder != NULL)
+	if (negative && status == SUCCESS)
 	{
-		size_t real_len = chain_length(remainder_int, initial_len);
-		real_len = (real_len != 0 ? real_len : 1);
-		leave_one_segment(remainder);
-		add_segments(remainder, real_len - 1);
-		size_t j = 0;
-		bigint_node *current = remainder->last;
-		for (j = 0; j < real_len; j++)
+		status = magnitude_step(number, TRUE);
+	}
+	return status;
+}
+
+size_t bigint_bit_length(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->last == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	return 32 * (number->length - 1) + bit_len(number->last->value);
+}
+
+size_t bigint_popcount(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	// Two's complement of negative number has infinitely many ones
+	if (number->sign == NEGATIVE)
+	{
+		return SIZE_MAX;
+	}
+
+	size_t count = 0;
+	bigint_node *current = number->first;
+	for (; current != NULL; current = current->next)
+	{
+		count += popcount_32(current->value);
+	}
+
+	return count;
+}
+
+size_t bigint_hamdist(bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (number1 == NULL || number2 == NULL || number1->first == NULL || number2->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	// Numbers of different signs differ in infinitely many bits
+	if (number1->sign != number2->sign)
+	{
+		return SIZE_MAX;
+	}
+
+	// Segments of the shorter number are extended with zeros, negative numbers are complemented on the fly
+	uint32_t carry1 = number1->sign, carry2 = number2->sign;
+	uint32_t value1 = 0, value2 = 0, mask = (number1->sign == NEGATIVE ? 0xffffffff : 0);
+	size_t count = 0;
+	bigint_node *current1 = number1->first, *current2 = number2->first;
+	while (current1 != NULL || current2 != NULL)
+	{
+		value1 = (current1 != NULL ? current1->value : 0);
+		value2 = (current2 != NULL ? current2->value : 0);
+		value1 = (value1 ^ mask) + carry1;
+		value2 = (value2 ^ mask) + carry2;
+		carry1 &= (value1 == 0);
+		carry2 &= (value2 == 0);
+		count += popcount_32(value1 ^ value2);
+		current1 = (current1 != NULL ? current1->next : NULL);
+		current2 = (current2 != NULL ? current2->next : NULL);
+	}
+
+	return count;
+}
+
+// Index of first bit equal to given value starting from start; SIZE_MAX if there is none
+size_t scan_bit(bigint number, size_t start, int bit)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	// Above the highest segment there are zeros for non-negative numbers and ones for negative ones
+	size_t segment = start / 32;
+	uint32_t extension = (number->sign == NEGATIVE ? 1 : 0);
+	if (segment >= number->length)
+	{
+		return ((uint32_t)bit == extension ? start : SIZE_MAX);
+	}
+
+	// Bits are complemented for negative numbers and once more when zeros are searched
+	uint32_t complement = (number->sign == NEGATIVE ? 0xffffffff : 0);
+	uint32_t search = (bit ? 0 : 0xffffffff);
+	uint32_t carry = (number->sign == NEGATIVE ? complement_carry(number, segment) : 0);
+	uint32_t value = 0;
+	bigint_node *current = node_at(number, segment);
+	size_t i = segment;
+	for (; current != NULL; current = current->next, i++)
+	{
+		value = (current->value ^ complement) + carry;
+		carry &= (value == 0);
+		value ^= search;
+		if (i == segment)
 		{
-			current->value = remainder_int[initial_len - real_len + j];
-			current = current->prev;
+			value &= 0xffffffff << (start % 32);
+		}
+		if (value != 0)
+		{
+			return 32 * i + trailing_zeros(value);
 		}
-		// Negative number division
-		remainder->sign = dividend->sign;
 	}
 
-	// free memory
-	free(dividend_int);
-	free(divisor_int);
-	free(remainder_int);
-	free(quotient_int);
-	return SUCCESS;
+	return ((uint32_t)bit == extension ? 32 * number->length : SIZE_MAX);
+}
+
+size_t bigint_scan0(bigint number, size_t start)
+{
+	return scan_bit(number, start, 0);
+}
+
+size_t bigint_scan1(bigint number, size_t start)
+{
+	return scan_bit(number, start, 1);
+}
+
+int bigint_tstbit(bigint number, size_t index)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t segment = index / 32;
+	if (segment >= number->length)
+	{
+		return (number->sign == NEGATIVE ? 1 : 0);
+	}
+
+	uint32_t value = node_at(number, segment)->value;
+	if (number->sign == NEGATIVE)
+	{
+		value = ~value + complement_carry(number, segment);
+	}
+	return (int)((value >> (index % 32)) & 1);
+}
+
+int bigint_setbit(bigint number, size_t index)
+{
+	return change_bit(number, index, BIT_SET);
+}
+
+int bigint_clrbit(bigint number, size_t index)
+{
+	return change_bit(number, index, BIT_CLEAR);
+}
+
+int bigint_combit(bigint number, size_t index)
+{
+	return change_bit(number, index, BIT_FLIP);
+}
+
+int bigint_compare_absolute(bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (number1 == NULL || number2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	if (number1->length != number2->length)
+	{
+		return (number1->length > number2->length ? 1 : -1);
+	}
+
+	size_t i = 0;
+	bigint_node *current1 = number1->last;
+	bigint_node *current2 = number2->last;
+	for (i = 0; i < number1->length; i++)
+	{
+		if (current1->value != current2->value)
+		{
+			return (current1->value > current2->value ? 1 : -1);
+		}
+		current1 = current1->prev;
+		current2 = current2->prev;
+	}
+	return 0;
+}
+
+int bigint_compare(bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (number1 == NULL || number2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	switch (2 * number1->sign + number2->sign)
+	{
+	case 0:
+		// Both numbers positive
+		return bigint_compare_absolute(number1, number2);
+	case 1:
+		// number1 positive, number2 negative
+		return 1;
+	case 2:
+		// number1 negative, number2 positive
+		return -1;
+	case 3:
+		// Both numbers negative
+		return bigint_compare_absolute(number2, number1);
+	default:
+		return 0;
+	}
+}
+
+int bigint_compare_status(int *result, bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || number1 == NULL || number2 == NULL || number1->last == NULL || number2->last == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Result is saved separately, so it cannot be confused with an error
+	*result = bigint_compare(number1, number2);
+	return SUCCESS;
+}
+
+// Compare absolute value of number with 64-bit integer; numbers longer than two segments are always greater
+int compare_u64(bigint number, uint64_t magnitude)
+{
+	if (number->length > 2)
+	{
+		return 1;
+	}
+
+	uint64_t value = number->first->value;
+	if (number->length == 2)
+	{
+		value |= (uint64_t)number->last->value << 32;
+	}
+	return (value > magnitude ? 1 : (value < magnitude ? -1 : 0));
+}
+
+int bigint_cmp_si(bigint number, long value)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	// Different signs decide without looking at segments
+	if (number->sign == NEGATIVE && value >= 0)
+	{
+		return -1;
+	}
+	if (number->sign == POSITIVE && value < 0)
+	{
+		return 1;
+	}
+
+	uint64_t magnitude = (value < 0 ? (uint64_t)0 - (uint64_t)value : (uint64_t)value);
+	int result = compare_u64(number, magnitude);
+	return (number->sign == NEGATIVE ? -result : result);
+}
+
+int bigint_cmp_ui(bigint number, unsigned long value)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	if (number->sign == NEGATIVE)
+	{
+		return -1;
+	}
+	return compare_u64(number, (uint64_t)value);
+}
+
+int bigint_cmpabs(bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (number1 == NULL || number2 == NULL || number1->last == NULL || number2->last == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	return bigint_compare_absolute(number1, number2);
+}
+
+int bigint_is_zero(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FALSE;
+	}
+
+	return (number->length == 1 && number->first->value == 0 ? TRUE : FALSE);
+}
+
+int bigint_is_one(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FALSE;
+	}
+
+	return (number->length == 1 && number->first->value == 1 && number->sign == POSITIVE ? TRUE : FALSE);
+}
+
+int bigint_sgn(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->first == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	if (number->length == 1 && number->first->value == 0)
+	{
+		return 0;
+	}
+	return (number->sign == NEGATIVE ? -1 : 1);
+}
+
+bigint bigint_copy(bigint number)
+{
+	// Wrong argument passed to function
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
+	}
+	bigint return_number = bigint_create_empty_segments(number->length);
+	return_number->length = number->length;
+	return_number->sign = number->sign;
+	bigint_node *current1 = return_number->first;
+	bigint_node *current2 = number->first;
+	size_t i = 0;
+	for (i = 0; i < number->length; i++)
+	{
+		current1->value = current2->value;
+		current1 = current1->next;
+		current2 = current2->next;
+	}
+	return return_number;
+}
+
+// Nodes of result are reused, so nothing is allocated if result is long enough
+int bigint_set(bigint result, bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	if (result == number)
+	{
+		return SUCCESS;
+	}
+	if (resize_segments(result, number->length) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	bigint_node *current1 = result->first;
+	bigint_node *current2 = number->first;
+	size_t i = 0;
+	for (i = 0; i < number->length; i++)
+	{
+		current1->value = current2->value;
+		current1 = current1->next;
+		current2 = current2->next;
+	}
+	result->sign = number->sign;
+
+	return SUCCESS;
+}
+
+int bigint_add_basic(bigint sum, bigint _summand1, bigint _summand2)
+{
+	// Wrong arguments passed to function
+	if (sum == NULL || _summand1 == NULL || _summand2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Just in case sum and summand 1/2 is the same number
+	bigint summand1 = bigint_copy(_summand1);
+	bigint summand2 = bigint_copy(_summand2);
+
+	bigint longer = (summand1->length > summand2->length ? summand1 : summand2);
+	bigint shorter = (summand1->length > summand2->length ? summand2 : summand1);
+
+	// Empty sum
+	reset(sum);
+	if (sum->length < longer->length + 1)
+	{
+		add_segments(sum, longer->length + 1 - sum->length);
+	}
+
+	bigint_node empty_node = {0, NULL, NULL};
+	empty_node.next = &empty_node;
+	uint64_t integer_sum = 0;
+	uint32_t temp = 0;
+	size_t i = 0;
+	bigint_node *current_sum = sum->first;
+	bigint_node *current_longer = longer->first;
+	bigint_node *current_shorter = shorter->first;
+	uint32_t *int_ptr = (uint32_t *)&integer_sum;
+	int endianness = check_endian();
+
+	for (i = 0; i <= longer->length; i++)
+	{
+		integer_sum = (uint64_t)(current_longer->value) + (uint64_t)(current_shorter->value) + (uint64_t)temp;
+		if (endianness == -1)
+		{
+			// Little endian
+			current_sum->value = int_ptr[0];
+			temp = int_ptr[1];
+		}
+		else
+		{
+			// Big endian
+			current_sum->value = int_ptr[1];
+			temp = int_ptr[0];
+		}
+
+		current_sum = current_sum->next;
+		current_shorter = (current_shorter->next == NULL ? &empty_node : current_shorter->next);
+		current_longer = (current_longer->next == NULL ? &empty_node : current_longer->next);
+	}
+
+	bigint_node *temp_ptr = NULL;
+	while (sum->last->value == 0 && sum->length != 1)
+	{
+		temp_ptr = sum->last;
+		sum->last->prev->next = NULL;
+		sum->last = sum->last->prev;
+		if (temp_ptr)
+		{
+			free(temp_ptr);
+			temp_ptr = NULL;
+		}
+		sum->length -= 1;
+	}
+
+	bigint_release_basic(summand1);
+	bigint_release_basic(summand2);
+
+	return SUCCESS;
+}
+
+int bigint_add_sign(bigint sum, bigint summand1, bigint summand2)
+{
+	// Wrong arguments
+	if (sum == NULL || summand1 == NULL || summand2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	int result = 0;
+	int comparison = 0;
+	switch (2 * summand1->sign + summand2->sign)
+	{
+	case 0:
+		// Both numbers positive
+		return bigint_add_basic(sum, summand1, summand2);
+	case 1:
+	case 2:
+		// Different sign
+		comparison = bigint_compare_absolute(summand1, summand2);
+		bigint bigger = (comparison == 1 ? summand1 : summand2);
+		bigint smaller = (comparison == 1 ? summand2 : summand1);
+		result = bigint_subtract_basic(sum, bigger, smaller);
+		sum->sign = (comparison == 0 ? 0 : bigger->sign);
+		return result;
+	case 3:
+		// Both numbers negative
+		result = bigint_add_basic(sum, summand1, summand2);
+		sum->sign = 1;
+		return result;
+	default:
+		return FAILURE;
+	}
+}
+
+int bigint_add(int args, bigint sum, ...)
+{
+
+	va_list ap;
+	va_start(ap, sum);
+
+	// Wrong arguments
+	if (args <= 0 || sum == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// In case sum is also one of summands
+	bigint temp_sum = bigint_create("0", 1);
+
+	int status = SUCCESS;
+	int i = 0;
+	for (i = 0; i < args; i++)
+	{
+		status = bigint_add_sign(temp_sum, temp_sum, va_arg(ap, bigint));
+		if (status == FAILURE)
+		{
+			return status;
+		}
+	}
+	va_end(ap);
+
+	bigint_release_segments(sum);
+	sum->length = temp_sum->length;
+	sum->first = temp_sum->first;
+	sum->last = temp_sum->last;
+	sum->sign = temp_sum->sign;
+	free(temp_sum);
+
+	return SUCCESS;
+}
+
+int bigint_increment_basic(bigint number)
+{
+	// Wrong arguments
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	// In case we need to add new segment
+	add_segments(number, 1);
+	size_t i = 0;
+	bigint_node *current = number->first;
+	for (i = 0; i < number->length; i++)
+	{
+		if (~(current->value) == 0)
+		{
+			current->value += 1;
+		}
+		else
+		{
+			current->value += 1;
+			break;
+		}
+		current = current->next;
+	}
+	if (number->last->value == 0 && number->length != 1)
+	{
+		bigint_node *temp = number->last;
+		number->last->prev->next = NULL;
+		number->last = number->last->prev;
+		free(temp);
+		number->length -= 1;
+	}
+	return SUCCESS;
+}
+
+int bigint_increment(bigint number)
+{
+	// Wrong argument
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	if (number->sign == 0)
+	{
+		// positive
+		bigint_increment_basic(number);
+	}
+	else
+	{
+		// negative
+		bigint_decrement_basic(number);
+		// change sign if necessary
+		if (number->length == 1 && number->first->value == 0)
+		{
+			number->sign = 0;
+		}
+	}
+	return SUCCESS;
+}
+
+int bigint_subtract_basic(bigint difference, bigint minuend, bigint subtrahend)
+{
+	// Main idea:
+	// x - y = x + ~y + 1
+
+	// Make sure minuend and subtrahend have the same length
+	bigint adjusted = bigint_create_empty_segments(minuend->length);
+	size_t i = 0;
+	bigint_node *current1 = subtrahend->first;
+	bigint_node *current2 = adjusted->first;
+	for (i = 0; i < subtrahend->length; i++)
+	{
+		current2->value = ~(current1->value);
+		current1 = current1->next;
+		current2 = current2->next;
+	}
+	for (i = subtrahend->length; i < minuend->length; i++)
+	{
+		current2->value = ~(uint32_t)0;
+		current2 = current2->next;
+	}
+
+	bigint_add_basic(difference, minuend, adjusted);
+	bigint_increment_basic(difference);
+	bigint_release_basic(adjusted);
+
+	// Delete last segment
+	difference->length -= 1;
+	difference->last->prev->next = NULL;
+	bigint_node *temp = difference->last;
+	difference->last = temp->prev;
+	free(temp);
+
+	// Delete segments filled with zeros
+	bigint_node *temp_ptr = NULL;
+	while (difference->last->value == 0 && difference->length != 1)
+	{
+		temp_ptr = difference->last;
+		difference->last->prev->next = NULL;
+		difference->last = difference->last->prev;
+		free(temp_ptr);
+		difference->length -= 1;
+	}
+
+	return SUCCESS;
+}
+
+int bigint_subtract(bigint difference, bigint minuend, bigint subtrahend)
+{
+	// Wrong arguments
+	if (difference == NULL || minuend == NULL || subtrahend == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	bigint bigger, smaller;
+	int result = 0;
+	int comparison = 0;
+	switch (2 * minuend->sign + subtrahend->sign)
+	{
+	case 0:
+		// Both numbers positive
+		comparison = bigint_compare_absolute(minuend, subtrahend);
+		bigger = (comparison == 1 ? minuend : subtrahend);
+		smaller = (comparison == 1 ? subtrahend : minuend);
+		result = bigint_subtract_basic(difference, bigger, smaller);
+		difference->sign = (comparison == 0 ? 0 : (subtrahend == bigger ? 1 : 0));
+		return result;
+	case 1:
+		// minuend positive, subtrahend negative
+		result = bigint_add_basic(difference, minuend, subtrahend);
+		difference->sign = 0;
+		return result;
+	case 2:
+		// minuend negative, subtrahend positive
+		result = bigint_add_basic(difference, minuend, subtrahend);
+		difference->sign = 1;
+		return result;
+	case 3:
+		// Both numbers negative
+		comparison = bigint_compare_absolute(minuend, subtrahend);
+		bigger = (comparison == 1 ? minuend : subtrahend);
+		smaller = (comparison == 1 ? subtrahend : minuend);
+		result = bigint_subtract_basic(difference, bigger, smaller);
+		difference->sign = (comparison != 1 ? 0 : 1);
+		return result;
+	}
+
+	return SUCCESS;
+}
+
+int bigint_decrement_basic(bigint number)
+{
+	// Wrong arguments
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	bigint ones = bigint_create_empty_segments(number->length);
+	bigint_not(ones);
+	bigint_add_basic(number, number, ones);
+
+	// Delete last segment
+	bigint_node *temp_ptr = number->last;
+	number->last->prev->next = NULL;
+	number->last = number->last->prev;
+	free(temp_ptr);
+	number->length -= 1;
+	bigint_release_basic(ones);
+	return SUCCESS;
+}
+
+int bigint_decrement(bigint number)
+{
+	// Wrong argument
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	// In case zero passed to function
+	if (number->length == 1 && number->first->value == 0)
+	{
+		number->first->value += 1;
+		number->sign = 1;
+		return SUCCESS;
+	}
+	if (number->sign == 0)
+	{
+		// positive
+		bigint_decrement_basic(number);
+	}
+	else
+	{
+		// negative
+		bigint_increment_basic(number);
+	}
+	return SUCCESS;
+}
+
+int reset(bigint number)
+{
+	bigint_node *current = number->first;
+	while (current != NULL)
+	{
+		current->value = 0;
+		current = current->next;
+	}
+	return SUCCESS;
+}
+
+int add_segments(bigint number, size_t count)
+{
+	if (count == 0)
+	{
+		return SUCCESS;
+	}
+
+	// Nodes are counted as they are added, so the list stays consistent if malloc fails
+	size_t i = 0;
+	bigint_node *current = number->last;
+	for (i = 0; i < count; i++)
+	{
+		current->next = (bigint_node *)malloc(sizeof(bigint_node));
+		check_memory_int(current->next);
+		initialise_node(current->next);
+		current->next->prev = current;
+		current = current->next;
+		number->last = current;
+		number->length += 1;
+	}
+	return SUCCESS;
+}
+
+int bigint_multiply_basic(bigint product, bigint _element1, bigint _element2)
+{
+
+	// Wrong arguments passed to function
+	if (product == NULL || _element1 == NULL || _element2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// In case product and _element1 or _element2 is the same number
+	bigint element1 = bigint_copy(_element1);
+	bigint element2 = bigint_copy(_element2);
+
+	bigint longer = (bigint_compare_absolute(element1, element2) == 1 ? element1 : element2);
+	bigint shorter = (bigint_compare_absolute(element1, element2) == 1 ? element2 : element1);
+
+	reset(product);
+	bigint_release_segments(product);
+	product->length = 1;
+	product->first = (bigint_node *)malloc(sizeof(bigint_node));
+	check_memory_int(product->first);
+	initialise_node(product->first);
+	product->last = product->first;
+
+	bigint temp = NULL;
+	size_t counter = 0;
+	size_t i = 0;
+	size_t j = 0;
+	bigint_node *current = shorter->first;
+	for (i = 0; i < shorter->length; i++)
+	{
+		for (j = 0; j < 32; j++)
+		{
+			if ((current->value & (1 << j)) != 0)
+			{
+				temp = bigint_copy(longer);
+				bigint_shift_left(temp, counter);
+				bigint_add_basic(product, product, temp);
+				bigint_release_basic(temp);
+			}
+			counter += 1;
+		}
+		current = current->next;
+	}
+
+	bigint_release_basic(element1);
+	bigint_release_basic(element2);
+
+	return SUCCESS;
+}
+
+int bigint_multiply(int count, bigint product, ...)
+{
+
+	va_list ap;
+	va_start(ap, product);
+
+	// Wrong arguments
+	if (count <= 0 || product == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// In case product appears as factor
+	bigint temp_product = bigint_create("1", 1);
+
+	int status = SUCCESS;
+	int i = 0;
+	uint8_t sign = 0;
+	bigint current = NULL;
+	for (i = 0; i < count; i++)
+	{
+		current = va_arg(ap, bigint);
+		status = bigint_multiply_basic(temp_product, temp_product, current);
+		if (status == FAILURE)
+		{
+			return status;
+		}
+		sign += current->sign;
+	}
+	va_end(ap);
+
+	bigint_release_segments(product);
+	product->length = temp_product->length;
+	product->first = temp_product->first;
+	product->last = temp_product->last;
+	free(temp_product);
+	product->sign = sign % 2;
+
+	return SUCCESS;
+}
+
+// Factors are multiplied as arrays of limbs; product may be the same variable as any factor
+int bigint_mul(bigint product, bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (product == NULL || number1 == NULL || number2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t length1 = 0, length2 = 0;
+	uint32_t *limbs1 = copy_to_limbs(number1, &length1);
+	uint32_t *limbs2 = copy_to_limbs(number2, &length2);
+	uint32_t *limbs = (uint32_t *)malloc((length1 + length2) * sizeof(uint32_t));
+	if (limbs1 == NULL || limbs2 == NULL || limbs == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(limbs1);
+		free(limbs2);
+		free(limbs);
+		return FAILURE;
+	}
+
+	int status = limbs_multiply(limbs, limbs1, length1, limbs2, length2);
+	if (status == SUCCESS)
+	{
+		status = save_limbs(product, limbs, length1 + length2, number1->sign ^ number2->sign);
+	}
+
+	free(limbs1);
+	free(limbs2);
+	free(limbs);
+	return status;
+}
+
+// result = result + number1 * number2 or result - number1 * number2, depending on subtract
+// The product is added to absolute value of result or subtracted from it without creating temporary variables
+int addmul(bigint result, bigint number1, bigint number2, uint8_t subtract)
+{
+	size_t length1 = 0, length2 = 0, length = 0;
+	uint32_t *limbs1 = copy_to_limbs(number1, &length1);
+	uint32_t *limbs2 = copy_to_limbs(number2, &length2);
+	uint32_t *limbs = copy_to_limbs(result, &length);
+	size_t product_length = length1 + length2;
+	uint32_t *product = (uint32_t *)malloc(((product_length > length ? product_length : length) + 1) * sizeof(uint32_t));
+	if (limbs1 == NULL || limbs2 == NULL || limbs == NULL || product == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(limbs1);
+		free(limbs2);
+		free(limbs);
+		free(product);
+		return FAILURE;
+	}
+
+	int status = limbs_multiply(product, limbs1, length1, limbs2, length2);
+	uint8_t product_sign = number1->sign ^ number2->sign ^ subtract;
+	uint8_t sign = result->sign;
+	product_length = limbs_normalize(product, product_length);
+	length = limbs_normalize(limbs, length);
+
+	// Sum of absolute values or the difference of the larger and the smaller one is computed in place of product
+	if (product_sign == sign && product_length >= length)
+	{
+		product[product_length] = limbs_add(product, product, product_length, limbs, length);
+		product_length++;
+	}
+	else if (product_sign == sign)
+	{
+		product[length] = limbs_add(product, limbs, length, product, product_length);
+		product_length = length + 1;
+	}
+	else if (limbs_compare(product, product_length, limbs, length) >= 0)
+	{
+		limbs_subtract(product, product, product_length, limbs, length);
+		sign = product_sign;
+	}
+	else
+	{
+		limbs_subtract(product, limbs, length, product, product_length);
+		product_length = length;
+	}
+	if (status == SUCCESS)
+	{
+		status = save_limbs(result, product, product_length, sign);
+	}
+
+	free(limbs1);
+	free(limbs2);
+	free(limbs);
+	free(product);
+	return status;
+}
+
+int bigint_addmul(bigint result, bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || number1 == NULL || number2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	return addmul(result, number1, number2, FALSE);
+}
+
+int bigint_submul(bigint result, bigint number1, bigint number2)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || number1 == NULL || number2 == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	return addmul(result, number1, number2, TRUE);
+}
+
+int leave_one_segment(bigint number)
+{
+	// Wrong argument
+	if (number == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	if (number->length == 1)
+	{
+		return SUCCESS;
+	}
+	bigint_node *current = number->first->next;
+	bigint_node *previous = NULL;
+	size_t i = 0;
+	for (i = 1; i < number->length; i++)
+	{
+		previous = current;
+		current = current->next;
+		free(previous);
+	}
+	number->last = number->first;
+	number->length = 1;
+	number->first->value = 0;
+	return SUCCESS;
+}
+
+uint32_t *chain_alignment(bigint number, size_t length)
+{
+	if (number->length > length)
+	{
+		return NULL;
+	}
+	if (number == NULL)
+	{
+		return NULL;
+	}
+	uint32_t *chain = (uint32_t *)malloc(length * sizeof(uint32_t));
+	memset(chain, 0, length * sizeof(uint32_t));
+	size_t shift = length - number->length;
+	bigint_node *current = number->last;
+	for (; shift < length; shift++)
+	{
+		chain[shift] = current->value;
+		current = current->prev;
+	}
+	return chain;
+}
+
+int array_shift_left(uint32_t *array, size_t length)
+{
+	size_t i = length - 1;
+	uint32_t remaining1 = 0;
+	uint32_t remaining2 = 0;
+	for (; i != 0; i--)
+	{
+		remaining1 = (array[i] & 0x80000000) >> 31;
+		array[i] = (array[i] << 1) | remaining2;
+		remaining2 = remaining1;
+	}
+	array[i] = (array[i] << 1) | remaining2;
+	return SUCCESS;
+}
+
+// Length must be the same
+int array_subtract(uint32_t *array1, uint32_t *array2, size_t length)
+{
+	int i = 0;
+	uint64_t sum = 0;
+	uint32_t temp = 0;
+	uint32_t *sum_ptr = (uint32_t *)&sum;
+	int endianness = check_endian();
+	for (i = length - 1; i >= 0; i--)
+	{
+		sum = (uint64_t)array1[i] + (uint64_t)(~array2[i]) + (uint64_t)temp;
+		if ((size_t)i == length - 1)
+		{
+			sum += 1;
+		}
+		if (endianness == -1)
+		{
+			// Little endian
+			array1[i] = sum_ptr[0];
+			temp = sum_ptr[1];
+		}
+		else
+		{
+			// Big endian
+			array1[i] = sum_ptr[1];
+			temp = sum_ptr[0];
+		}
+	}
+	return SUCCESS;
+}
+
+int greater_or_eq(uint32_t *array1, uint32_t *array2, size_t length)
+{
+	size_t i = 0;
+	for (i = 0; i < length; i++)
+	{
+		if (array1[i] > array2[i])
+		{
+			return 1;
+		}
+		else if (array1[i] < array2[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int bigint_divide(bigint dividend, bigint divisor, bigint quotient, bigint remainder)
+{
+
+	// Wrong arguments passed to function
+	if (dividend == NULL || divisor == NULL || (quotient == NULL && remainder == NULL))
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (divisor->length == 1 && divisor->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	// In case dividend and quotient are the same;
+	// Later on we change quotient's length
+	size_t initial_len = dividend->length;
+
+	int comparison = bigint_compare_absolute(dividend, divisor);
+
+	// Divisor is greater than dividend or divisor is equal to dividend
+	if (comparison == -1 || comparison == 0)
+	{
+		if (quotient != NULL)
+		{
+			bigint_release_segments(quotient);
+			bigint_node *node = (bigint_node *)malloc(sizeof(bigint_node));
+			check_memory_int(node);
+			initialise_node(node);
+			if (comparison == 0)
+			{
+				node->value = 1;
+				quotient->sign = (dividend->sign == divisor->sign ? 0 : 1);
+			}
+			else
+			{
+				node->value = 0;
+				quotient->sign = 0;
+			}
+			quotient->length = 1;
+			quotient->first = quotient->last = node;
+		}
+		if (remainder != NULL)
+		{
+			bigint_release_segments(remainder);
+			if (comparison == 0)
+			{
+				bigint_node *node = (bigint_node *)malloc(sizeof(bigint_node));
+				check_memory_int(node);
+				initialise_node(node);
+				node->value = 0;
+				remainder->sign = 0;
+				remainder->length = 1;
+				remainder->first = remainder->last = node;
+			}
+			else
+			{
+				bigint temp = bigint_copy(dividend);
+				remainder->length = temp->length;
+				remainder->first = temp->first;
+				remainder->last = temp->last;
+				remainder->sign = temp->sign;
+				free(temp);
+			}
+		}
+		return SUCCESS;
+	}
+
+	size_t length = (initial_len) * sizeof(uint32_t);
+	uint32_t *remainder_int = (uint32_t *)malloc(length);
+	check_memory_int(remainder_int);
+	uint32_t *quotient_int = (uint32_t *)malloc(length);
+	check_memory_int(remainder_int);
+	memset(remainder_int, 0, length);
+	memset(quotient_int, 0, length);
+
+	uint32_t *dividend_int = copy_to_chain(dividend);
+	uint32_t *divisor_int = chain_alignment(divisor, initial_len);
+	int i = (initial_len - 1) * sizeof(uint32_t) * 8 + bit_len(dividend_int[0]) - 1;
+	uint32_t bit = 0;
+
+	for (; i >= 0; i--)
+	{
+		array_shift_left(remainder_int, initial_len);
+		bit = get_n_bit(dividend_int, initial_len, i);
+		if (bit)
+		{
+			remainder_int[initial_len - 1] |= 1;
+		}
+		if (greater_or_eq(remainder_int, divisor_int, initial_len))
+		{
+			array_subtract(remainder_int, divisor_int, initial_len);
+			set_n_bit_to_1(quotient_int, initial_len, i);
+		}
+	}
+
+	// Save result to quotient bigint structure
+	if (quotient != NULL)
+	{
+		size_t real_len = chain_length(quotient_int, initial_len);
+		real_len = (real_len != 0 ? real_len : 1);
+		leave_one_segment(quotient);
+		add_segments(quotient, real_len - 1);
+		size_t j = 0;
+		bigint_node *current = quotient->last;
+		for (j = 0; j < real_len; j++)
+		{
+			current->value = quotient_int[initial_len - real_len + j];
+			current = current->prev;
+		}
+		// Negative number division
+		quotient->sign = (dividend->sign + divisor->sign == 1 ? 1 : 0);
+	}
+
+	// save result to remainder bigint structure
+	if (remainder != NULL)
+	{
+		size_t real_len = chain_length(remainder_int, initial_len);
+		real_len = (real_len != 0 ? real_len : 1);
+		leave_one_segment(remainder);
+		add_segments(remainder, real_len - 1);
+		size_t j = 0;
+		bigint_node *current = remainder->last;
+		for (j = 0; j < real_len; j++)
+		{
+			current->value = remainder_int[initial_len - real_len + j];
+			current = current->prev;
+		}
+		// Negative number division, zero remainder is never negative
+		remainder->sign = (real_len == 1 && remainder->first->value == 0 ? 0 : dividend->sign);
+	}
+
+	// free memory
+	free(dividend_int);
+	free(divisor_int);
+	free(remainder_int);
+	free(quotient_int);
+	return SUCCESS;
+}
+
+// Save values of nodes in linked list to array; unlike copy_to_chain() least significant limb goes first
+uint32_t *copy_to_limbs(bigint number, size_t *length)
+{
+	uint32_t *limbs = (uint32_t *)malloc(number->length * sizeof(uint32_t));
+	check_memory_ptr(limbs);
+
+	size_t i = 0;
+	bigint_node *current = number->first;
+	for (i = 0; i < number->length; i++)
+	{
+		limbs[i] = current->value;
+		current = current->next;
+	}
+	*length = number->length;
+
+	return limbs;
+}
+
+// Change number of nodes in linked list reusing the ones that already exist
+int resize_segments(bigint number, size_t length)
+{
+	if (number->length < length)
+	{
+		return add_segments(number, length - number->length);
+	}
+
+	bigint_node *temp = NULL;
+	while (number->length > length)
+	{
+		temp = number->last;
+		number->last = temp->prev;
+		number->last->next = NULL;
+		free(temp);
+		number->length -= 1;
+	}
+
+	return SUCCESS;
+}
+
+// Save array of limbs (least significant first) to existing bigint
+int save_limbs(bigint number, uint32_t *limbs, size_t length, uint8_t sign)
+{
+	length = limbs_normalize(limbs, length);
+	if (resize_segments(number, (length != 0 ? length : 1)) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	number->first->value = 0;
+	size_t i = 0;
+	bigint_node *current = number->first;
+	for (i = 0; i < length; i++)
+	{
+		current->value = limbs[i];
+		current = current->next;
+	}
+
+	// Zero cannot be negative
+	number->sign = (length == 0 ? POSITIVE : sign);
+
+	return SUCCESS;
+}
+
+// Number of limbs without leading zeros
+size_t limbs_normalize(uint32_t *limbs, size_t length)
+{
+	while (length > 0 && limbs[length - 1] == 0)
+	{
+		length--;
+	}
+	return length;
+}
+
+// result = limbs1 + limbs2, length1 >= length2; returns carry
+uint32_t limbs_add(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	uint64_t sum = 0;
+	size_t i = 0;
+	for (i = 0; i < length2; i++)
+	{
+		sum += (uint64_t)limbs1[i] + limbs2[i];
+		result[i] = (uint32_t)sum;
+		sum >>= 32;
+	}
+	for (; i < length1; i++)
+	{
+		sum += limbs1[i];
+		result[i] = (uint32_t)sum;
+		sum >>= 32;
+	}
+	return (uint32_t)sum;
+}
+
+// result = limbs1 - limbs2, length1 >= length2; returns borrow
+uint32_t limbs_subtract(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	uint64_t difference = 0;
+	uint32_t borrow = 0;
+	size_t i = 0;
+	for (i = 0; i < length2; i++)
+	{
+		difference = (uint64_t)limbs1[i] - limbs2[i] - borrow;
+		result[i] = (uint32_t)difference;
+		borrow = (uint32_t)(difference >> 63);
+	}
+	for (; i < length1; i++)
+	{
+		difference = (uint64_t)limbs1[i] - borrow;
+		result[i] = (uint32_t)difference;
+		borrow = (uint32_t)(difference >> 63);
+	}
+	return borrow;
+}
+
+// result = limbs * factor; returns the most significant limb
+uint32_t limbs_multiply_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor)
+{
+	uint64_t carry = 0;
+	size_t i = 0;
+	for (i = 0; i < length; i++)
+	{
+		carry += (uint64_t)limbs[i] * factor;
+		result[i] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	return (uint32_t)carry;
+}
+
+// result += limbs * factor; returns carry
+uint32_t limbs_addmul_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor)
+{
+	uint64_t carry = 0;
+	size_t i = 0;
+	for (i = 0; i < length; i++)
+	{
+		carry += (uint64_t)limbs[i] * factor + result[i];
+		result[i] = (uint32_t)carry;
+		carry >>= 32;
+	}
+	return (uint32_t)carry;
+}
+
+// result -= limbs * factor; returns borrow
+uint32_t limbs_submul_1(uint32_t *result, uint32_t *limbs, size_t length, uint32_t factor)
+{
+	uint64_t carry = 0;
+	uint32_t low = 0;
+	size_t i = 0;
+	for (i = 0; i < length; i++)
+	{
+		carry += (uint64_t)limbs[i] * factor;
+		low = (uint32_t)carry;
+		carry >>= 32;
+		if (result[i] < low)
+		{
+			carry++;
+		}
+		result[i] -= low;
+	}
+	return (uint32_t)carry;
+}
+
+// result = limbs << bits, bits < 32; returns bits shifted out; result may overlap limbs if result >= limbs
+uint32_t limbs_shift_left(uint32_t *result, uint32_t *limbs, size_t length, unsigned int bits)
+{
+	if (length == 0)
+	{
+		return 0;
+	}
+	if (bits == 0)
+	{
+		memmove(result, limbs, length * sizeof(uint32_t));
+		return 0;
+	}
+
+	uint32_t out = limbs[length - 1] >> (32 - bits);
+	size_t i = 0;
+	for (i = length - 1; i > 0; i--)
+	{
+		result[i] = (limbs[i] << bits) | (limbs[i - 1] >> (32 - bits));
+	}
+	result[0] = limbs[0] << bits;
+	return out;
+}
+
+// result = limbs >> bits, bits < 32; returns bits shifted out; result may overlap limbs if result <= limbs
+uint32_t limbs_shift_right(uint32_t *result, uint32_t *limbs, size_t length, unsigned int bits)
+{
+	if (length == 0)
+	{
+		return 0;
+	}
+	if (bits == 0)
+	{
+		memmove(result, limbs, length * sizeof(uint32_t));
+		return 0;
+	}
+
+	uint32_t out = limbs[0] << (32 - bits);
+	size_t i = 0;
+	for (i = 0; i < length - 1; i++)
+	{
+		result[i] = (limbs[i] >> bits) | (limbs[i + 1] << (32 - bits));
+	}
+	result[length - 1] = limbs[length - 1] >> bits;
+	return out;
+}
+
+// Inverse of odd limb modulo 2^32 found with Newton's iteration
+uint32_t limb_inverse(uint32_t limb)
+{
+	// Each step doubles number of correct bits; limb is its own inverse modulo 8
+	uint32_t inverse = limb;
+	int i = 0;
+	for (i = 0; i < 4; i++)
+	{
+		inverse *= 2 - limb * inverse;
+	}
+	return inverse;
+}
+
+// Schoolbook multiplication; result needs length1 + length2 limbs
+void limbs_multiply_basecase(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	memset(result, 0, length1 * sizeof(uint32_t));
+	size_t i = 0;
+	for (i = 0; i < length2; i++)
+	{
+		result[length1 + i] = limbs_addmul_1(result + i, limbs1, length1, limbs2[i]);
+	}
+}
+
+// Karatsuba multiplication of two numbers of the same length; result needs 2 * length limbs
+int limbs_karatsuba(uint32_t *result, uint32_t *limbs1, uint32_t *limbs2, size_t length)
+{
+	size_t low = length / 2;
+	size_t high = length - low;
+
+	// Space for (a0 + a1), (b0 + b1) and their product
+	uint32_t *sum1 = (uint32_t *)malloc((4 * high + 4) * sizeof(uint32_t));
+	check_memory_int(sum1);
+	uint32_t *sum2 = sum1 + high + 1;
+	uint32_t *middle = sum2 + high + 1;
+
+	// a0 * b0 and a1 * b1 go straight to their places in result
+	if (limbs_multiply(result, limbs1, low, limbs2, low) == FAILURE ||
+	    limbs_multiply(result + 2 * low, limbs1 + low, high, limbs2 + low, high) == FAILURE)
+	{
+		free(sum1);
+		return FAILURE;
+	}
+
+	// (a0 + a1) * (b0 + b1) - a0 * b0 - a1 * b1
+	sum1[high] = limbs_add(sum1, limbs1 + low, high, limbs1, low);
+	sum2[high] = limbs_add(sum2, limbs2 + low, high, limbs2, low);
+	if (limbs_multiply(middle, sum1, high + 1, sum2, high + 1) == FAILURE)
+	{
+		free(sum1);
+		return FAILURE;
+	}
+	limbs_subtract(middle, middle, 2 * high + 2, result, 2 * low);
+	limbs_subtract(middle, middle, 2 * high + 2, result + 2 * low, 2 * high);
+
+	size_t middle_length = limbs_normalize(middle, 2 * high + 2);
+	limbs_add(result + low, result + low, 2 * length - low, middle, middle_length);
+
+	free(sum1);
+	return SUCCESS;
+}
+
+// result = limbs1 * limbs2; result needs length1 + length2 limbs and cannot overlap arguments
+int limbs_multiply(uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	// Make sure the first number is the longer one
+	if (length1 < length2)
+	{
+		return limbs_multiply(result, limbs2, length2, limbs1, length1);
+	}
+
+	if (length2 < KARATSUBA_THRESHOLD)
+	{
+		limbs_multiply_basecase(result, limbs1, length1, limbs2, length2);
+		return SUCCESS;
+	}
+
+	if (length1 == length2)
+	{
+		return limbs_karatsuba(result, limbs1, limbs2, length1);
+	}
+
+	// Unbalanced operands: multiply pieces of the longer one having length of the shorter one
+	uint32_t *temp = (uint32_t *)malloc(2 * length2 * sizeof(uint32_t));
+	check_memory_int(temp);
+	memset(result, 0, (length1 + length2) * sizeof(uint32_t));
+
+	size_t offset = 0;
+	size_t piece = 0;
+	for (offset = 0; offset < length1; offset += length2)
+	{
+		piece = (length1 - offset < length2 ? length1 - offset : length2);
+		if (limbs_multiply(temp, limbs1 + offset, piece, limbs2, length2) == FAILURE)
+		{
+			free(temp);
+			return FAILURE;
+		}
+		limbs_add(result + offset, result + offset, length1 + length2 - offset, temp, piece + length2);
+	}
+
+	free(temp);
+	return SUCCESS;
+}
+
+// Multiply nonzero factors using binary splitting so that operands stay balanced
+uint32_t *limbs_product(uint32_t *factors, size_t count, size_t *length)
+{
+	uint32_t *result = NULL;
+	size_t i = 0;
+
+	// Few factors are multiplied one by one
+	if (count <= PRODUCT_TREE_LEAF)
+	{
+		result = (uint32_t *)malloc((count + 1) * sizeof(uint32_t));
+		check_memory_ptr(result);
+		result[0] = 1;
+		*length = 1;
+		uint32_t carry = 0;
+		for (i = 0; i < count; i++)
+		{
+			carry = limbs_multiply_1(result, result, *length, factors[i]);
+			if (carry != 0)
+			{
+				result[(*length)++] = carry;
+			}
+		}
+		return result;
+	}
+
+	size_t length1 = 0, length2 = 0;
+	uint32_t *product1 = limbs_product(factors, count / 2, &length1);
+	uint32_t *product2 = limbs_product(factors + count / 2, count - count / 2, &length2);
+	if (product1 != NULL && product2 != NULL)
+	{
+		result = (uint32_t *)malloc((length1 + length2) * sizeof(uint32_t));
+	}
+	if (result == NULL || limbs_multiply(result, product1, length1, product2, length2) == FAILURE)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(product1);
+		free(product2);
+		free(result);
+		return NULL;
+	}
+	*length = limbs_normalize(result, length1 + length2);
+
+	free(product1);
+	free(product2);
+	return result;
+}
+
+// Sieve of Eratosthenes; returns all primes not greater than limit
+uint32_t *sieve_primes(uint32_t limit, size_t *count)
+{
+	*count = 0;
+
+	// Only odd numbers are stored: index i stands for 2 * i + 1
+	size_t size = (size_t)limit / 2 + 1;
+	uint8_t *composite = (uint8_t *)malloc(size);
+	check_memory_ptr(composite);
+	memset(composite, 0, size);
+
+	size_t i = 0, j = 0, found = (limit >= 2 ? 1 : 0);
+	uint64_t prime = 0;
+	for (i = 1; i < size; i++)
+	{
+		prime = 2 * i + 1;
+		if (prime > limit)
+		{
+			break;
+		}
+		if (composite[i])
+		{
+			continue;
+		}
+		found++;
+		for (j = (size_t)(prime * prime / 2); prime * prime <= limit && j < size; j += (size_t)prime)
+		{
+			composite[j] = 1;
+		}
+	}
+
+	uint32_t *primes = (uint32_t *)malloc((found + 1) * sizeof(uint32_t));
+	if (primes == NULL)
+	{
+		free(composite);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return NULL;
+	}
+	if (limit >= 2)
+	{
+		primes[(*count)++] = 2;
+	}
+	for (i = 1; i < size && (uint64_t)(2 * i + 1) <= limit; i++)
+	{
+		if (composite[i] == 0)
+		{
+			primes[(*count)++] = (uint32_t)(2 * i + 1);
+		}
+	}
+
+	free(composite);
+	return primes;
+}
+
+// Odd part of n! computed as (odd part of (n/2)!)^2 * odd part of swinging factorial of n
+uint32_t *odd_factorial(uint32_t n, uint32_t *primes, size_t primes_count, size_t *length)
+{
+	uint32_t *result = NULL;
+	if (n < 3)
+	{
+		result = (uint32_t *)malloc(sizeof(uint32_t));
+		check_memory_ptr(result);
+		result[0] = 1;
+		*length = 1;
+		return result;
+	}
+
+	// Prime factorization of swinging factorial n! / ((n/2)!)^2 without powers of two
+	uint32_t *factors = (uint32_t *)malloc(primes_count * sizeof(uint32_t));
+	check_memory_ptr(factors);
+	size_t count = 0, i = 0;
+	uint64_t power = 0;
+	uint32_t quotient = 0;
+	for (i = 1; i < primes_count && primes[i] <= n; i++)
+	{
+		power = 1;
+		quotient = n;
+		while ((quotient /= primes[i]) > 0)
+		{
+			if (quotient & 1)
+			{
+				power *= primes[i];
+			}
+		}
+		if (power > 1)
+		{
+			factors[count++] = (uint32_t)power;
+		}
+	}
+
+	size_t swing_length = 0, half_length = 0;
+	uint32_t *swing = limbs_product(factors, count, &swing_length);
+	uint32_t *half = odd_factorial(n / 2, primes, primes_count, &half_length);
+	uint32_t *square = NULL;
+	free(factors);
+	if (swing != NULL && half != NULL)
+	{
+		square = (uint32_t *)malloc(2 * half_length * sizeof(uint32_t));
+		result = (uint32_t *)malloc((2 * half_length + swing_length) * sizeof(uint32_t));
+	}
+	if (square == NULL || result == NULL ||
+	    limbs_multiply(square, half, half_length, half, half_length) == FAILURE ||
+	    limbs_multiply(result, square, limbs_normalize(square, 2 * half_length), swing, swing_length) == FAILURE)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(swing);
+		free(half);
+		free(square);
+		free(result);
+		return NULL;
+	}
+	*length = limbs_normalize(result, limbs_normalize(square, 2 * half_length) + swing_length);
+
+	free(swing);
+	free(half);
+	free(square);
+	return result;
+}
+
+int bigint_fac_ui(bigint result, unsigned long n)
+{
+	// Wrong arguments
+	if (result == NULL || n > UINT32_MAX)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t primes_count = 0, length = 0;
+	uint32_t *primes = sieve_primes((uint32_t)n, &primes_count);
+	check_memory_int(primes);
+	uint32_t *odd = odd_factorial((uint32_t)n, primes, primes_count, &length);
+	free(primes);
+	check_memory_int(odd);
+
+	// n! contains 2 raised to the power of n minus number of ones in binary representation of n
+	size_t twos = n;
+	unsigned long temp = n;
+	for (; temp != 0; temp >>= 1)
+	{
+		twos -= temp & 1;
+	}
+
+	size_t words = twos / 32;
+	uint32_t *limbs = (uint32_t *)malloc((length + words + 1) * sizeof(uint32_t));
+	if (limbs == NULL)
+	{
+		free(odd);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return FAILURE;
+	}
+	memset(limbs, 0, words * sizeof(uint32_t));
+	limbs[length + words] = limbs_shift_left(limbs + words, odd, length, twos % 32);
+
+	int status = save_limbs(result, limbs, length + words + 1, POSITIVE);
+	free(odd);
+	free(limbs);
+	return status;
+}
+
+// Append factor to the list; the array grows twice when it is full
+int push_factor(struct factor_list *list, uint32_t factor)
+{
+	if (list->count == list->capacity)
+	{
+		size_t capacity = (list->capacity == 0 ? 64 : 2 * list->capacity);
+		uint32_t *factors = (uint32_t *)realloc(list->factors, capacity * sizeof(uint32_t));
+		check_memory_int(factors);
+		list->factors = factors;
+		list->capacity = capacity;
+	}
+
+	list->factors[list->count++] = factor;
+	return SUCCESS;
+}
+
+// Largest number whose square is not greater than n (Newton's method)
+uint32_t square_root(uint32_t n)
+{
+	uint64_t root = n, next = ((uint64_t)n + 1) / 2;
+	while (next < root)
+	{
+		root = next;
+		next = (root + n / root) / 2;
+	}
+	return (uint32_t)root;
+}
+
+// C(n, k) = n * (n - 1) * ... * (n - k + 1) / k! for small k, 0 < k <= n
+int binomial_product(bigint result, uint32_t n, uint32_t k)
+{
+	uint32_t *factors = (uint32_t *)malloc(k * sizeof(uint32_t));
+	check_memory_int(factors);
+	size_t i = 0, length = 0;
+	for (i = 0; i < k; i++)
+	{
+		factors[i] = n - (uint32_t)i;
+	}
+	uint32_t *limbs = limbs_product(factors, k, &length);
+	free(factors);
+	check_memory_int(limbs);
+
+	bigint factorial = bigint_create_empty_segments(1);
+	int status = (factorial == NULL ? FAILURE : save_limbs(result, limbs, length, POSITIVE));
+	free(limbs);
+	if (status == SUCCESS)
+	{
+		status = bigint_fac_ui(factorial, k);
+	}
+	if (status == SUCCESS)
+	{
+		status = bigint_divexact(result, result, factorial);
+	}
+	if (factorial != NULL)
+	{
+		bigint_release_basic(factorial);
+	}
+	return status;
+}
+
+// Exponent of p equals number of carries when adding k and n - k in base p (Kummer's theorem)
+int binomial_kummer(bigint result, uint32_t n, uint32_t k)
+{
+	size_t primes_count = 0, length = 0;
+	uint32_t *primes = sieve_primes(n, &primes_count);
+	check_memory_int(primes);
+
+	size_t count = 0, i = 0;
+	uint64_t power = 0, factor = 0;
+	for (i = 0; i < primes_count; i++)
+	{
+		factor = 1;
+		for (power = primes[i]; power <= n; power *= primes[i])
+		{
+			if (n / power - k / power - (n - k) / power)
+			{
+				factor *= primes[i];
+			}
+		}
+		if (factor > 1)
+		{
+			primes[count++] = (uint32_t)factor;
+		}
+	}
+
+	uint32_t *limbs = limbs_product(primes, count, &length);
+	free(primes);
+	check_memory_int(limbs);
+
+	int status = save_limbs(result, limbs, length, POSITIVE);
+	free(limbs);
+	return status;
+}
+
+// Append primes from (low, high] that divide C(n, k); low is not less than square root of n
+// Such prime has two digits in base p, so it divides C(n, k) once if n mod p < k mod p and not at all otherwise
+// Numbers are sieved in blocks of constant size with primes up to square root of n
+int binomial_large_primes(struct factor_list *list, uint64_t low, uint64_t high, uint32_t n, uint32_t k, uint32_t *primes, size_t primes_count)
+{
+	uint8_t *composite = (uint8_t *)malloc(BINOMIAL_SIEVE_BLOCK);
+	check_memory_int(composite);
+
+	uint64_t start = 0, end = 0, multiple = 0, number = 0;
+	size_t i = 0;
+	int status = SUCCESS;
+	for (start = low + 1; start <= high && status == SUCCESS; start = end + 1)
+	{
+		end = (high - start < BINOMIAL_SIEVE_BLOCK ? high : start + BINOMIAL_SIEVE_BLOCK - 1);
+		memset(composite, 0, (size_t)(end - start + 1));
+		for (i = 0; i < primes_count && (uint64_t)primes[i] * primes[i] <= end; i++)
+		{
+			for (multiple = (start + primes[i] - 1) / primes[i] * primes[i]; multiple <= end; multiple += primes[i])
+			{
+				composite[multiple - start] = 1;
+			}
+		}
+		for (number = start; number <= end && status == SUCCESS; number++)
+		{
+			if (!composite[number - start] && n % number < k % number)
+			{
+				status = push_factor(list, (uint32_t)number);
+			}
+		}
+	}
+
+	free(composite);
+	return status;
+}
+
+// Only primes up to square root of n are sieved at once, larger primes are looked for where they may be factors
+int binomial_split(bigint result, uint32_t n, uint32_t k)
+{
+	uint32_t root = square_root(n);
+	size_t primes_count = 0, length = 0;
+	uint32_t *primes = sieve_primes(root, &primes_count);
+	check_memory_int(primes);
+
+	// Small primes may have any exponent (Kummer's theorem)
+	struct factor_list list;
+	memset(&list, 0, sizeof(struct factor_list));
+	int status = SUCCESS;
+	size_t i = 0;
+	uint64_t power = 0, factor = 0;
+	for (i = 0; i < primes_count && status == SUCCESS; i++)
+	{
+		factor = 1;
+		for (power = primes[i]; power <= n; power *= primes[i])
+		{
+			if (n / power - k / power - (n - k) / power)
+			{
+				factor *= primes[i];
+			}
+		}
+		if (factor > 1)
+		{
+			status = push_factor(&list, (uint32_t)factor);
+		}
+	}
+
+	// Any prime between square root of n and k may be a factor
+	uint32_t bound = (k > root ? k : root);
+	if (status == SUCCESS && k > root)
+	{
+		status = binomial_large_primes(&list, root, k, n, k, primes, primes_count);
+	}
+
+	// Prime p > k with n / p = j is a factor if n - j * p < k, so it lies in ((n - k) / j, n / j]
+	uint64_t j = 0, low = 0, high = 0;
+	for (j = 1; status == SUCCESS && n / j > bound; j++)
+	{
+		high = n / j;
+		low = (n - k) / j;
+		low = (low > n / (j + 1) ? low : n / (j + 1));
+		low = (low > bound ? low : bound);
+		if (low < high)
+		{
+			status = binomial_large_primes(&list, low, high, n, k, primes, primes_count);
+		}
+	}
+	free(primes);
+
+	uint32_t *limbs = (status == SUCCESS ? limbs_product(list.factors, list.count, &length) : NULL);
+	free(list.factors);
+	if (limbs == NULL)
+	{
+		return FAILURE;
+	}
+
+	status = save_limbs(result, limbs, length, POSITIVE);
+	free(limbs);
+	return status;
+}
+
+int bigint_bin_uiui(bigint result, unsigned long n, unsigned long k)
+{
+	// Wrong arguments
+	if (result == NULL || n > UINT32_MAX)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Binomial coefficient equals zero or one
+	uint32_t zero = 0, one = 1;
+	if (k > n)
+	{
+		return save_limbs(result, &zero, 1, POSITIVE);
+	}
+	if (k > n - k)
+	{
+		k = n - k;
+	}
+	if (k == 0)
+	{
+		return save_limbs(result, &one, 1, POSITIVE);
+	}
+
+	if (k <= BINOMIAL_PRODUCT_THRESHOLD)
+	{
+		return binomial_product(result, (uint32_t)n, (uint32_t)k);
+	}
+	if (k > n / BINOMIAL_SIEVE_FRACTION)
+	{
+		return binomial_kummer(result, (uint32_t)n, (uint32_t)k);
+	}
+	return binomial_split(result, (uint32_t)n, (uint32_t)k);
+}
+
+int bigint_primorial_ui(bigint result, unsigned long n)
+{
+	// Wrong arguments
+	if (result == NULL || n > UINT32_MAX)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t primes_count = 0, length = 0;
+	uint32_t *primes = sieve_primes((uint32_t)n, &primes_count);
+	check_memory_int(primes);
+	uint32_t *limbs = limbs_product(primes, primes_count, &length);
+	free(primes);
+	check_memory_int(limbs);
+
+	int status = save_limbs(result, limbs, length, POSITIVE);
+	free(limbs);
+	return status;
+}
+
+// Fibonacci numbers F(n) and F(n - 1), n > 0, computed with doubling formulas:
+// F(2k - 1) = F(k)^2 + F(k - 1)^2
+// F(2k + 1) = 4F(k)^2 - F(k - 1)^2 + 2(-1)^k
+// F(2k) = F(2k + 1) - F(2k - 1)
+// Returns memory block that contains both numbers and should be freed afterwards
+uint32_t *fibonacci_pair(unsigned long n, uint32_t **fn, uint32_t **fn1, size_t *length)
+{
+	// F(n) has less than 0.7n bits
+	size_t capacity = n / 32 + 6;
+	uint32_t *block = (uint32_t *)malloc(4 * capacity * sizeof(uint32_t));
+	check_memory_ptr(block);
+
+	uint32_t *current = block, *previous = block + capacity;
+	uint32_t *square1 = block + 2 * capacity, *square2 = block + 3 * capacity;
+	uint32_t *temp = NULL;
+	uint32_t two = 2;
+	current[0] = 1;
+	previous[0] = 0;
+	size_t len = 1;
+	uint8_t odd = TRUE;
+
+	// Find the most significant bit of n
+	int bit = (int)(sizeof(unsigned long) * 8) - 1;
+	while (((n >> bit) & 1) == 0)
+	{
+		bit--;
+	}
+
+	for (bit--; bit >= 0; bit--)
+	{
+		if (limbs_multiply(square1, current, len, current, len) == FAILURE ||
+		    limbs_multiply(square2, previous, len, previous, len) == FAILURE)
+		{
+			free(block);
+			return NULL;
+		}
+		square1[2 * len] = square2[2 * len] = 0;
+
+		// F(2k - 1) goes to previous
+		previous[2 * len] = limbs_add(previous, square1, 2 * len, square2, 2 * len);
+
+		// F(2k + 1) goes to square1
+		square1[2 * len] = limbs_shift_left(square1, square1, 2 * len, 2);
+		limbs_subtract(square1, square1, 2 * len + 1, square2, 2 * len + 1);
+		if (odd)
+		{
+			limbs_subtract(square1, square1, 2 * len + 1, &two, 1);
+		}
+		else
+		{
+			limbs_add(square1, square1, 2 * len + 1, &two, 1);
+		}
+
+		// F(2k) = F(2k + 1) - F(2k - 1)
+		limbs_subtract(current, square1, 2 * len + 1, previous, 2 * len + 1);
+		if ((n >> bit) & 1)
+		{
+			// k becomes 2k + 1: pair F(2k + 1), F(2k)
+			temp = previous;
+			previous = current;
+			current = square1;
+			square1 = temp;
+			odd = TRUE;
+		}
+		else
+		{
+			// k becomes 2k: pair F(2k), F(2k - 1)
+			odd = FALSE;
+		}
+		len = limbs_normalize(current, 2 * len + 1);
+	}
+
+	*fn = current;
+	*fn1 = previous;
+	*length = len;
+	return block;
+}
+
+int bigint_fib_ui(bigint result, unsigned long n)
+{
+	// Wrong argument
+	if (result == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	uint32_t zero = 0;
+	if (n == 0)
+	{
+		return save_limbs(result, &zero, 1, POSITIVE);
+	}
+
+	uint32_t *fn = NULL, *fn1 = NULL;
+	size_t length = 0;
+	uint32_t *block = fibonacci_pair(n, &fn, &fn1, &length);
+	check_memory_int(block);
+
+	int status = save_limbs(result, fn, length, POSITIVE);
+	free(block);
+	return status;
+}
+
+int bigint_lucnum_ui(bigint result, unsigned long n)
+{
+	// Wrong argument
+	if (result == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	uint32_t two = 2;
+	if (n == 0)
+	{
+		return save_limbs(result, &two, 1, POSITIVE);
+	}
+
+	uint32_t *fn = NULL, *fn1 = NULL;
+	size_t length = 0;
+	uint32_t *block = fibonacci_pair(n, &fn, &fn1, &length);
+	check_memory_int(block);
+
+	// L(n) = F(n) + 2F(n - 1); there is spare space after F(n - 1)
+	fn1[length] = limbs_shift_left(fn1, fn1, length, 1);
+	fn[length] = 0;
+	limbs_add(fn1, fn1, length + 1, fn, length + 1);
+
+	int status = save_limbs(result, fn1, length + 1, POSITIVE);
+	free(block);
+	return status;
+}
+
+int bigint_divexact(bigint quotient, bigint dividend, bigint divisor)
+{
+	// Wrong arguments passed to function
+	if (quotient == NULL || dividend == NULL || divisor == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (divisor->length == 1 && divisor->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	uint8_t sign = (dividend->sign == divisor->sign ? POSITIVE : NEGATIVE);
+	size_t length1 = 0, length2 = 0;
+	uint32_t *limbs1 = copy_to_limbs(dividend, &length1);
+	check_memory_int(limbs1);
+	uint32_t *limbs2 = copy_to_limbs(divisor, &length2);
+	if (limbs2 == NULL)
+	{
+		free(limbs1);
+		return FAILURE;
+	}
+	length1 = limbs_normalize(limbs1, length1);
+	length2 = limbs_normalize(limbs2, length2);
+
+	// Remove powers of two from divisor; dividend is divisible by them as well
+	size_t zeros = 0;
+	unsigned int bits = 0;
+	while (limbs2[zeros] == 0)
+	{
+		zeros++;
+	}
+	while (((limbs2[zeros] >> bits) & 1) == 0)
+	{
+		bits++;
+	}
+	limbs_shift_right(limbs2, limbs2 + zeros, length2 - zeros, bits);
+	length2 = limbs_normalize(limbs2, length2 - zeros);
+	if (length1 > zeros)
+	{
+		limbs_shift_right(limbs1, limbs1 + zeros, length1 - zeros, bits);
+		length1 = limbs_normalize(limbs1, length1 - zeros);
+	}
+	else
+	{
+		length1 = 0;
+	}
+
+	// Only zero is divisible by a greater number
+	if (length1 < length2)
+	{
+		free(limbs2);
+		limbs1[0] = 0;
+		int status = save_limbs(quotient, limbs1, 1, POSITIVE);
+		free(limbs1);
+		return status;
+	}
+
+	size_t quotient_length = length1 - length2 + 1;
+	uint32_t *quotient_limbs = (uint32_t *)malloc(quotient_length * sizeof(uint32_t));
+	if (quotient_limbs == NULL)
+	{
+		free(limbs1);
+		free(limbs2);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return FAILURE;
+	}
+
+	// Hensel division: each quotient limb zeroes the lowest remaining limb of dividend, no remainder is computed
+	uint32_t inverse = limb_inverse(limbs2[0]);
+	uint32_t borrow = 0, previous = 0;
+	size_t i = 0, j = 0, count = 0;
+	for (i = 0; i < quotient_length; i++)
+	{
+		quotient_limbs[i] = limbs1[i] * inverse;
+		count = (length1 - i < length2 ? length1 - i : length2);
+		borrow = limbs_submul_1(limbs1 + i, limbs2, count, quotient_limbs[i]);
+		for (j = i + count; borrow != 0 && j < length1; j++)
+		{
+			previous = limbs1[j];
+			limbs1[j] -= borrow;
+			borrow = (previous < borrow ? 1 : 0);
+		}
+	}
+
+	int status = save_limbs(quotient, quotient_limbs, quotient_length, sign);
+	free(limbs1);
+	free(limbs2);
+	free(quotient_limbs);
+	return status;
+}
+
+// Compare two normalized arrays of limbs
+int limbs_compare(uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	if (length1 != length2)
+	{
+		return (length1 > length2 ? 1 : -1);
+	}
+	while (length1 > 0)
+	{
+		length1--;
+		if (limbs1[length1] != limbs2[length1])
+		{
+			return (limbs1[length1] > limbs2[length1] ? 1 : -1);
+		}
+	}
+	return 0;
+}
+
+// quotient = limbs / divisor; quotient may be NULL; returns remainder
+uint32_t limbs_divide_1(uint32_t *quotient, uint32_t *limbs, size_t length, uint32_t divisor)
+{
+	uint64_t remainder = 0;
+	while (length > 0)
+	{
+		length--;
+		remainder = (remainder << 32) | limbs[length];
+		if (quotient != NULL)
+		{
+			quotient[length] = (uint32_t)(remainder / divisor);
+		}
+		remainder %= divisor;
+	}
+	return (uint32_t)remainder;
+}
+
+// Knuth's algorithm D; length1 >= length2 and the most significant limb of limbs2 cannot be zero
+// quotient needs length1 - length2 + 1 limbs and remainder length2 limbs; any of them may be NULL
+int limbs_divide(uint32_t *quotient, uint32_t *remainder, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2)
+{
+	if (length2 == 1)
+	{
+		uint32_t rest = limbs_divide_1(quotient, limbs1, length1, limbs2[0]);
+		if (remainder != NULL)
+		{
+			remainder[0] = rest;
+		}
+		return SUCCESS;
+	}
+
+	// Shift both numbers so that the most significant bit of divisor is set
+	unsigned int shift = 32 - (unsigned int)bit_len(limbs2[length2 - 1]);
+	uint32_t *dividend = (uint32_t *)malloc((length1 + 1 + length2) * sizeof(uint32_t));
+	check_memory_int(dividend);
+	uint32_t *divisor = dividend + length1 + 1;
+	limbs_shift_left(divisor, limbs2, length2, shift);
+	dividend[length1] = limbs_shift_left(dividend, limbs1, length1, shift);
+
+	uint32_t top1 = divisor[length2 - 1], top2 = divisor[length2 - 2];
+	uint64_t estimate = 0, rest = 0;
+	uint32_t borrow = 0;
+	size_t j = length1 - length2 + 1;
+	while (j > 0)
+	{
+		j--;
+
+		// Estimate quotient limb from the top limbs; it may be too large by at most two
+		estimate = (((uint64_t)dividend[j + length2] << 32) | dividend[j + length2 - 1]) / top1;
+		rest = (((uint64_t)dividend[j + length2] << 32) | dividend[j + length2 - 1]) % top1;
+		while (estimate > UINT32_MAX || estimate * top2 > ((rest << 32) | dividend[j + length2 - 2]))
+		{
+			estimate--;
+			rest += top1;
+			if (rest > UINT32_MAX)
+			{
+				break;
+			}
+		}
+
+		// Subtract and add divisor back if the estimate was still too large
+		borrow = limbs_submul_1(dividend + j, divisor, length2, (uint32_t)estimate);
+		if (dividend[j + length2] < borrow)
+		{
+			estimate--;
+			dividend[j + length2] += limbs_add(dividend + j, dividend + j, length2, divisor, length2);
+		}
+		dividend[j + length2] -= borrow;
+
+		if (quotient != NULL)
+		{
+			quotient[j] = (uint32_t)estimate;
+		}
+	}
+
+	if (remainder != NULL)
+	{
+		limbs_shift_right(remainder, dividend, length2, shift);
+	}
+
+	free(dividend);
+	return SUCCESS;
+}
+
+// Save absolute value of number and recognize moduli of form 2^k - c or 2^k + c
+int prepare_modulus(struct bigint_modulus *modulus, bigint number)
+{
+	modulus->scratch = NULL;
+	modulus->scratch_length = 0;
+	modulus->limbs = copy_to_limbs(number, &modulus->length);
+	check_memory_int(modulus->limbs);
+	modulus->length = limbs_normalize(modulus->limbs, modulus->length);
+	modulus->form = GENERAL_MODULUS;
+
+	// Space for product of two residues
+	modulus->product = (uint32_t *)malloc((2 * modulus->length + 1) * sizeof(uint32_t));
+	if (modulus->product == NULL)
+	{
+		free(modulus->limbs);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return FAILURE;
+	}
+
+	size_t length = modulus->length;
+	size_t bits = 32 * (length - 1) + bit_len(modulus->limbs[length - 1]);
+	if (bits <= SPECIAL_MODULUS_MIN_BITS)
+	{
+		return SUCCESS;
+	}
+
+	// Limbs between the lowest and the highest one decide about the form
+	uint32_t top = modulus->limbs[length - 1];
+	int minus = (top == (UINT32_MAX >> (32 - bit_len(top))) && modulus->limbs[0] != 0);
+	int plus = (top == ((uint32_t)1 << (bit_len(top) - 1)));
+	size_t i = 0;
+	for (i = 1; i < length - 1; i++)
+	{
+		minus = minus && modulus->limbs[i] == UINT32_MAX;
+		plus = plus && modulus->limbs[i] == 0;
+	}
+
+	if (minus)
+	{
+		// m = 2^bits - c
+		modulus->form = MINUS_FORM_MODULUS;
+		modulus->k = bits;
+		modulus->c = 0 - modulus->limbs[0];
+	}
+	else if (plus)
+	{
+		// m = 2^(bits - 1) + c
+		modulus->form = PLUS_FORM_MODULUS;
+		modulus->k = bits - 1;
+		modulus->c = modulus->limbs[0];
+	}
+
+	return SUCCESS;
+}
+
+void release_modulus(struct bigint_modulus *modulus)
+{
+	free(modulus->limbs);
+	free(modulus->scratch);
+	free(modulus->product);
+}
+
+// Make sure scratch space has at least given number of limbs
+int reserve_scratch(struct bigint_modulus *modulus, size_t length)
+{
+	if (modulus->scratch_length >= length)
+	{
+		return SUCCESS;
+	}
+	uint32_t *scratch = (uint32_t *)realloc(modulus->scratch, length * sizeof(uint32_t));
+	check_memory_int(scratch);
+	modulus->scratch = scratch;
+	modulus->scratch_length = length;
+	return SUCCESS;
+}
+
+// Reduction modulo 2^k - c or 2^k + c: x = high * 2^k + low is congruent to low + c * high or low - c * high
+// Only shifts and multiplication by one limb are needed; limbs need space for length + 1 limbs
+int reduce_special(struct bigint_modulus *modulus, uint32_t *limbs, size_t *length)
+{
+	size_t words = modulus->k / 32;
+	unsigned int bits = modulus->k % 32;
+	size_t len = limbs_normalize(limbs, *length);
+	if (reserve_scratch(modulus, 2 * len + 2) == FAILURE)
+	{
+		return FAILURE;
+	}
+	uint32_t *high = modulus->scratch;
+	uint32_t *product = modulus->scratch + len + 1;
+	size_t high_length = 0, product_length = 0, longer = 0;
+	uint8_t sign = POSITIVE;
+
+	while (len > words && (len - 1 > words || bit_len(limbs[len - 1]) > bits))
+	{
+		// Split number into high and low part
+		high_length = len - words;
+		limbs_shift_right(high, limbs + words, high_length, bits);
+		high_length = limbs_normalize(high, high_length);
+		if (bits != 0)
+		{
+			limbs[words] &= ((uint32_t)1 << bits) - 1;
+			len = limbs_normalize(limbs, words + 1);
+		}
+		else
+		{
+			len = limbs_normalize(limbs, words);
+		}
+
+		product[high_length] = limbs_multiply_1(product, high, high_length, modulus->c);
+		product_length = limbs_normalize(product, high_length + 1);
+
+		if (modulus->form == MINUS_FORM_MODULUS)
+		{
+			longer = (len > product_length ? len : product_length);
+			memset(limbs + len, 0, (longer + 1 - len) * sizeof(uint32_t));
+			limbs[longer] = limbs_add(limbs, limbs, longer, product, product_length);
+			len = limbs_normalize(limbs, longer + 1);
+		}
+		else if (limbs_compare(limbs, len, product, product_length) >= 0)
+		{
+			limbs_subtract(limbs, limbs, len, product, product_length);
+			len = limbs_normalize(limbs, len);
+		}
+		else
+		{
+			// low - c * high is negative
+			limbs_subtract(product, product, product_length, limbs, len);
+			len = limbs_normalize(product, product_length);
+			memcpy(limbs, product, len * sizeof(uint32_t));
+			sign = (sign == POSITIVE ? NEGATIVE : POSITIVE);
+		}
+	}
+
+	// Now number is smaller than 2^k
+	if (modulus->form == MINUS_FORM_MODULUS && limbs_compare(limbs, len, modulus->limbs, modulus->length) >= 0)
+	{
+		limbs_subtract(limbs, limbs, len, modulus->limbs, modulus->length);
+		len = limbs_normalize(limbs, len);
+	}
+	else if (sign == NEGATIVE && len != 0)
+	{
+		memset(limbs + len, 0, (modulus->length - len) * sizeof(uint32_t));
+		limbs_subtract(limbs, modulus->limbs, modulus->length, limbs, modulus->length);
+		len = limbs_normalize(limbs, modulus->length);
+	}
+
+	*length = len;
+	return SUCCESS;
+}
+
+// Reduce nonnegative number modulo prepared modulus; limbs need space for max(length, modulus length) + 1 limbs
+int reduce(struct bigint_modulus *modulus, uint32_t *limbs, size_t *length)
+{
+	if (modulus->form != GENERAL_MODULUS)
+	{
+		return reduce_special(modulus, limbs, length);
+	}
+
+	size_t len = limbs_normalize(limbs, *length);
+	if (len < modulus->length)
+	{
+		*length = len;
+		return SUCCESS;
+	}
+	if (reserve_scratch(modulus, modulus->length) == FAILURE ||
+	    limbs_divide(NULL, modulus->scratch, limbs, len, modulus->limbs, modulus->length) == FAILURE)
+	{
+		return FAILURE;
+	}
+	memcpy(limbs, modulus->scratch, modulus->length * sizeof(uint32_t));
+	*length = limbs_normalize(limbs, modulus->length);
+	return SUCCESS;
+}
+
+// result = limbs1 * limbs2 mod modulus; both factors must be already reduced; result may overlap factors
+int multiply_modulo(struct bigint_modulus *modulus, uint32_t *result, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2, size_t *length)
+{
+	if (length1 == 0 || length2 == 0)
+	{
+		*length = 0;
+		return SUCCESS;
+	}
+
+	uint32_t *product = modulus->product;
+	size_t product_length = length1 + length2;
+	if (limbs_multiply(product, limbs1, length1, limbs2, length2) == FAILURE ||
+	    reduce(modulus, product, &product_length) == FAILURE)
+	{
+		return FAILURE;
+	}
+	memcpy(result, product, product_length * sizeof(uint32_t));
+	*length = product_length;
+
+	return SUCCESS;
+}
+
+// Nonnegative residue of number; the returned array has space for modulus length + 1 limbs
+uint32_t *copy_residue(struct bigint_modulus *modulus, bigint number, size_t *length)
+{
+	size_t len = (number->length > modulus->length ? number->length : modulus->length) + 1;
+	uint32_t *limbs = (uint32_t *)malloc(len * sizeof(uint32_t));
+	check_memory_ptr(limbs);
+
+	size_t i = 0;
+	bigint_node *current = number->first;
+	for (i = 0; i < number->length; i++)
+	{
+		limbs[i] = current->value;
+		current = current->next;
+	}
+	len = number->length;
+	if (reduce(modulus, limbs, &len) == FAILURE)
+	{
+		free(limbs);
+		return NULL;
+	}
+
+	// Negative number
+	if (number->sign == NEGATIVE && len != 0)
+	{
+		memset(limbs + len, 0, (modulus->length - len) * sizeof(uint32_t));
+		limbs_subtract(limbs, modulus->limbs, modulus->length, limbs, modulus->length);
+		len = limbs_normalize(limbs, modulus->length);
+	}
+
+	*length = len;
+	return limbs;
+}
+
+int bigint_mod(bigint result, bigint number, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL || modulus == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	size_t length = 0;
+	uint32_t *limbs = copy_residue(&prepared, number, &length);
+	int status = (limbs != NULL ? save_limbs(result, limbs, length, POSITIVE) : FAILURE);
+
+	free(limbs);
+	release_modulus(&prepared);
+	return status;
+}
+
+// Factors are reduced first, so the product is not longer than twice the modulus
+int bigint_mulmod(bigint result, bigint number1, bigint number2, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (result == NULL || number1 == NULL || number2 == NULL || modulus == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	size_t length1 = 0, length2 = 0, length = 0;
+	uint32_t *limbs1 = copy_residue(&prepared, number1, &length1);
+	uint32_t *limbs2 = (limbs1 == NULL ? NULL : copy_residue(&prepared, number2, &length2));
+	int status = (limbs2 != NULL ? multiply_modulo(&prepared, limbs1, limbs1, length1, limbs2, length2, &length) : FAILURE);
+	if (status == SUCCESS)
+	{
+		status = save_limbs(result, limbs1, length, POSITIVE);
+	}
+
+	free(limbs1);
+	free(limbs2);
+	release_modulus(&prepared);
+	return status;
+}
+
+int bigint_powm(bigint result, bigint base, bigint exponent, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (result == NULL || base == NULL || exponent == NULL || modulus == NULL || exponent->sign == NEGATIVE)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	size_t size = prepared.length + 1;
+	size_t base_length = 0, exponent_length = 0, length = 0;
+	uint32_t *base_limbs = copy_residue(&prepared, base, &base_length);
+	uint32_t *exponent_limbs = copy_to_limbs(exponent, &exponent_length);
+	uint32_t *table = (uint32_t *)malloc(((1 << POWM_WINDOW) + 1) * size * sizeof(uint32_t));
+	size_t table_lengths[1 << POWM_WINDOW];
+	if (base_limbs == NULL || exponent_limbs == NULL || table == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(base_limbs);
+		free(exponent_limbs);
+		free(table);
+		release_modulus(&prepared);
+		return FAILURE;
+	}
+	uint32_t *accumulator = table + (1 << POWM_WINDOW) * size;
+
+	// Table of base^i for all windows; 1 mod 1 equals 0
+	int status = SUCCESS;
+	size_t i = 0;
+	table[0] = 1;
+	table_lengths[0] = (prepared.length == 1 && prepared.limbs[0] == 1 ? 0 : 1);
+	for (i = 1; i < (1 << POWM_WINDOW) && status == SUCCESS; i++)
+	{
+		status = multiply_modulo(&prepared, table + i * size, table + (i - 1) * size, table_lengths[i - 1], base_limbs, base_length, &table_lengths[i]);
+	}
+
+	// Left-to-right exponentiation processing POWM_WINDOW bits at once
+	memcpy(accumulator, table, size * sizeof(uint32_t));
+	length = table_lengths[0];
+	size_t bit = 32 * exponent_length;
+	unsigned int window = 0, j = 0;
+	while (bit > 0 && status == SUCCESS)
+	{
+		bit -= POWM_WINDOW;
+		for (j = 0; j < POWM_WINDOW && status == SUCCESS; j++)
+		{
+			status = multiply_modulo(&prepared, accumulator, accumulator, length, accumulator, length, &length);
+		}
+		window = (exponent_limbs[bit / 32] >> (bit % 32)) & ((1 << POWM_WINDOW) - 1);
+		if (window != 0 && status == SUCCESS)
+		{
+			status = multiply_modulo(&prepared, accumulator, accumulator, length, table + window * size, table_lengths[window], &length);
+		}
+	}
+
+	if (status == SUCCESS)
+	{
+		status = save_limbs(result, accumulator, length, POSITIVE);
+	}
+
+	free(base_limbs);
+	free(exponent_limbs);
+	free(table);
+	release_modulus(&prepared);
+	return status;
+}
+
+// Bits from position bit to bit + width - 1 of array of limbs, width < 32
+uint32_t limbs_window(uint32_t *limbs, size_t length, size_t bit, unsigned int width)
+{
+	size_t index = bit / 32;
+	uint64_t value = 0;
+	if (index < length)
+	{
+		value = limbs[index];
+	}
+	if (index + 1 < length)
+	{
+		value |= (uint64_t)limbs[index + 1] << 32;
+	}
+	return (uint32_t)(value >> (bit % 32)) & (((uint32_t)1 << width) - 1);
+}
+
+// Inverse of reduced nonzero number with extended Euclidean algorithm; result needs modulus length + 1 limbs
+// Coefficients of the algorithm alternate in sign, so only their absolute values are stored
+int limbs_invert(uint32_t *result, size_t *length, uint32_t *limbs, size_t len, struct bigint_modulus *modulus)
+{
+	size_t size = modulus->length + 3;
+	uint32_t *block = (uint32_t *)malloc(6 * size * sizeof(uint32_t));
+	check_memory_int(block);
+	uint32_t *remainder1 = block, *remainder2 = block + size, *remainder3 = block + 2 * size;
+	uint32_t *coefficient1 = block + 3 * size, *coefficient2 = block + 4 * size, *coefficient3 = block + 5 * size;
+	uint32_t *quotient = result, *temp = NULL;
+	size_t length1 = modulus->length, length2 = len, length3 = 0;
+	size_t coefficient_length1 = 0, coefficient_length2 = 1, coefficient_length3 = 0, quotient_length = 0;
+	size_t steps = 0;
+
+	memcpy(remainder1, modulus->limbs, length1 * sizeof(uint32_t));
+	memcpy(remainder2, limbs, length2 * sizeof(uint32_t));
+	coefficient2[0] = 1;
+
+	while (length2 != 0)
+	{
+		// remainder1 = quotient * remainder2 + remainder3
+		quotient_length = length1 - length2 + 1;
+		if (limbs_divide(quotient, remainder3, remainder1, length1, remainder2, length2) == FAILURE)
+		{
+			free(block);
+			return FAILURE;
+		}
+		quotient_length = limbs_normalize(quotient, quotient_length);
+		length3 = limbs_normalize(remainder3, length2);
+
+		// coefficient3 = coefficient1 + quotient * coefficient2
+		if (limbs_multiply(coefficient3, quotient, quotient_length, coefficient2, coefficient_length2) == FAILURE)
+		{
+			free(block);
+			return FAILURE;
+		}
+		coefficient_length3 = limbs_normalize(coefficient3, quotient_length + coefficient_length2);
+		if (coefficient_length3 < coefficient_length1)
+		{
+			memset(coefficient3 + coefficient_length3, 0, (coefficient_length1 - coefficient_length3) * sizeof(uint32_t));
+			coefficient_length3 = coefficient_length1;
+		}
+		coefficient3[coefficient_length3] = limbs_add(coefficient3, coefficient3, coefficient_length3, coefficient1, coefficient_length1);
+		coefficient_length3 = limbs_normalize(coefficient3, coefficient_length3 + 1);
+
+		// Move to the next step
+		temp = remainder1;
+		remainder1 = remainder2;
+		remainder2 = remainder3;
+		remainder3 = temp;
+		length1 = length2;
+		length2 = length3;
+		temp = coefficient1;
+		coefficient1 = coefficient2;
+		coefficient2 = coefficient3;
+		coefficient3 = temp;
+		coefficient_length1 = coefficient_length2;
+		coefficient_length2 = coefficient_length3;
+		steps++;
+	}
+
+	// Greatest common divisor is in remainder1
+	if (length1 != 1 || remainder1[0] != 1)
+	{
+		free(block);
+		bigint_errno = BIGINT_NOT_INVERTIBLE;
+		return FAILURE;
+	}
+
+	// Coefficient is negative after even number of steps
+	if (steps % 2 == 0)
+	{
+		memset(coefficient1 + coefficient_length1, 0, (modulus->length - coefficient_length1) * sizeof(uint32_t));
+		limbs_subtract(result, modulus->limbs, modulus->length, coefficient1, modulus->length);
+		*length = limbs_normalize(result, modulus->length);
+	}
+	else
+	{
+		memcpy(result, coefficient1, coefficient_length1 * sizeof(uint32_t));
+		*length = coefficient_length1;
+	}
+
+	free(block);
+	return SUCCESS;
+}
+
+int bigint_invert(bigint result, bigint number, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (result == NULL || number == NULL || modulus == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	size_t length = 0;
+	uint32_t *limbs = copy_residue(&prepared, number, &length);
+	uint32_t *inverse = (uint32_t *)malloc((prepared.length + 1) * sizeof(uint32_t));
+	int status = (limbs != NULL && inverse != NULL ? SUCCESS : FAILURE);
+	if (status == FAILURE)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+	}
+	else if (prepared.length == 1 && prepared.limbs[0] == 1)
+	{
+		// Every number modulo 1 equals 0
+		status = save_limbs(result, limbs, 0, POSITIVE);
+	}
+	else if (length == 0)
+	{
+		bigint_errno = BIGINT_NOT_INVERTIBLE;
+		status = FAILURE;
+	}
+	else if ((status = limbs_invert(inverse, &length, limbs, length, &prepared)) == SUCCESS)
+	{
+		status = save_limbs(result, inverse, length, POSITIVE);
+	}
+
+	free(limbs);
+	free(inverse);
+	release_modulus(&prepared);
+	return status;
+}
+
+int bigint_invert_batch(bigint *results, bigint *numbers, size_t count, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (results == NULL || numbers == NULL || modulus == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	size_t i = 0;
+	for (i = 0; i < count; i++)
+	{
+		if (results[i] == NULL || numbers[i] == NULL)
+		{
+			bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+			return FAILURE;
+		}
+	}
+	if (count == 0)
+	{
+		return SUCCESS;
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	// Residues of numbers and their prefix products; inverse takes two more arrays
+	size_t size = prepared.length + 1;
+	uint32_t *residues = (uint32_t *)malloc((2 * count + 2) * size * sizeof(uint32_t));
+	size_t *lengths = (size_t *)malloc(2 * count * sizeof(size_t));
+	if (residues == NULL || lengths == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(residues);
+		free(lengths);
+		release_modulus(&prepared);
+		return FAILURE;
+	}
+	uint32_t *prefixes = residues + count * size;
+	uint32_t *inverse = prefixes + count * size;
+	uint32_t *temp = inverse + size;
+	size_t *prefix_lengths = lengths + count;
+	size_t inverse_length = 0;
+
+	int status = SUCCESS;
+	uint32_t *limbs = NULL;
+	for (i = 0; i < count && status == SUCCESS; i++)
+	{
+		limbs = copy_residue(&prepared, numbers[i], &lengths[i]);
+		if (limbs == NULL)
+		{
+			status = FAILURE;
+			break;
+		}
+		memcpy(residues + i * size, limbs, lengths[i] * sizeof(uint32_t));
+		free(limbs);
+		if (i == 0)
+		{
+			memcpy(prefixes, residues, lengths[0] * sizeof(uint32_t));
+			prefix_lengths[0] = lengths[0];
+		}
+		else
+		{
+			status = multiply_modulo(&prepared, prefixes + i * size, prefixes + (i - 1) * size, prefix_lengths[i - 1], residues + i * size, lengths[i], &prefix_lengths[i]);
+		}
+	}
+
+	// Only one inversion: product of all numbers
+	if (status == SUCCESS && prepared.length == 1 && prepared.limbs[0] == 1)
+	{
+		for (i = 0; i < count && status == SUCCESS; i++)
+		{
+			status = save_limbs(results[i], inverse, 0, POSITIVE);
+		}
+		count = 0;
+	}
+	else if (status == SUCCESS && prefix_lengths[count - 1] == 0)
+	{
+		bigint_errno = BIGINT_NOT_INVERTIBLE;
+		status = FAILURE;
+	}
+	else if (status == SUCCESS)
+	{
+		status = limbs_invert(inverse, &inverse_length, prefixes + (count - 1) * size, prefix_lengths[count - 1], &prepared);
+	}
+
+	// Going backwards: inverse of i-th number = inverse of i-th prefix * (i - 1)-th prefix
+	size_t length = 0;
+	for (i = count; i > 1 && status == SUCCESS; i--)
+	{
+		status = multiply_modulo(&prepared, temp, inverse, inverse_length, prefixes + (i - 2) * size, prefix_lengths[i - 2], &length);
+		if (status == SUCCESS)
+		{
+			status = save_limbs(results[i - 1], temp, length, POSITIVE);
+		}
+		if (status == SUCCESS)
+		{
+			status = multiply_modulo(&prepared, inverse, inverse, inverse_length, residues + (i - 1) * size, lengths[i - 1], &inverse_length);
+		}
+	}
+	if (status == SUCCESS && count != 0)
+	{
+		status = save_limbs(results[0], inverse, inverse_length, POSITIVE);
+	}
+
+	free(residues);
+	free(lengths);
+	release_modulus(&prepared);
+	return status;
+}
+
+// Simultaneous exponentiation with powers of every base precomputed for windows of POWM_WINDOW bits
+int powm_straus(struct bigint_modulus *modulus, uint32_t *result, size_t *length, uint32_t **bases, size_t *base_lengths, uint32_t **exponents, size_t *exponent_lengths, size_t count, size_t bits)
+{
+	size_t size = modulus->length + 1;
+	size_t entries = (size_t)1 << POWM_WINDOW;
+	uint32_t *table = (uint32_t *)malloc(count * entries * size * sizeof(uint32_t));
+	size_t *table_lengths = (size_t *)malloc(count * entries * sizeof(size_t));
+	if (table == NULL || table_lengths == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(table);
+		free(table_lengths);
+		return FAILURE;
+	}
+
+	// base^j for every base; entry 0 is never used
+	int status = SUCCESS;
+	size_t i = 0, j = 0, entry = 0;
+	for (i = 0; i < count && status == SUCCESS; i++)
+	{
+		entry = i * entries;
+		memcpy(table + (entry + 1) * size, bases[i], base_lengths[i] * sizeof(uint32_t));
+		table_lengths[entry + 1] = base_lengths[i];
+		for (j = 2; j < entries && status == SUCCESS; j++)
+		{
+			status = multiply_modulo(modulus, table + (entry + j) * size, table + (entry + j - 1) * size, table_lengths[entry + j - 1], bases[i], base_lengths[i], &table_lengths[entry + j]);
+		}
+	}
+
+	// Squarings are shared by all bases
+	size_t bit = (bits + POWM_WINDOW - 1) / POWM_WINDOW * POWM_WINDOW;
+	uint32_t window = 0;
+	while (bit > 0 && status == SUCCESS)
+	{
+		bit -= POWM_WINDOW;
+		for (j = 0; j < POWM_WINDOW && status == SUCCESS; j++)
+		{
+			status = multiply_modulo(modulus, result, result, *length, result, *length, length);
+		}
+		for (i = 0; i < count && status == SUCCESS; i++)
+		{
+			window = limbs_window(exponents[i], exponent_lengths[i], bit, POWM_WINDOW);
+			if (window != 0)
+			{
+				entry = i * entries + window;
+				status = multiply_modulo(modulus, result, result, *length, table + entry * size, table_lengths[entry], length);
+			}
+		}
+	}
+
+	free(table);
+	free(table_lengths);
+	return status;
+}
+
+// Simultaneous exponentiation collecting bases in buckets according to their windows (Pippenger's method)
+int powm_buckets(struct bigint_modulus *modulus, uint32_t *result, size_t *length, uint32_t **bases, size_t *base_lengths, uint32_t **exponents, size_t *exponent_lengths, size_t count, size_t bits)
+{
+	// Each window costs count + 2^(width + 1) multiplications
+	unsigned int width = 1, best = 1;
+	double cost = 0, best_cost = 0;
+	for (width = 1; width < 20; width++)
+	{
+		cost = (double)((bits + width - 1) / width) * (double)(count + ((size_t)2 << width));
+		if (width == 1 || cost < best_cost)
+		{
+			best_cost = cost;
+			best = width;
+		}
+	}
+	width = best;
+
+	size_t size = modulus->length + 1;
+	size_t entries = (size_t)1 << width;
+	uint32_t *buckets = (uint32_t *)malloc((entries + 2) * size * sizeof(uint32_t));
+	size_t *bucket_lengths = (size_t *)malloc(entries * sizeof(size_t));
+	uint8_t *used = (uint8_t *)malloc(entries);
+	if (buckets == NULL || bucket_lengths == NULL || used == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(buckets);
+		free(bucket_lengths);
+		free(used);
+		return FAILURE;
+	}
+	uint32_t *running = buckets + entries * size;
+	uint32_t *total = running + size;
+	size_t running_length = 0, total_length = 0;
+	uint8_t running_used = FALSE, total_used = FALSE;
+
+	int status = SUCCESS;
+	size_t bit = (bits + width - 1) / width * width;
+	size_t i = 0, j = 0;
+	uint32_t window = 0;
+	while (bit > 0 && status == SUCCESS)
+	{
+		bit -= width;
+		for (j = 0; j < width && status == SUCCESS; j++)
+		{
+			status = multiply_modulo(modulus, result, result, *length, result, *length, length);
+		}
+
+		// Product of bases with the same window
+		memset(used, FALSE, entries);
+		for (i = 0; i < count && status == SUCCESS; i++)
+		{
+			window = limbs_window(exponents[i], exponent_lengths[i], bit, width);
+			if (window == 0)
+			{
+				continue;
+			}
+			if (used[window])
+			{
+				status = multiply_modulo(modulus, buckets + window * size, buckets + window * size, bucket_lengths[window], bases[i], base_lengths[i], &bucket_lengths[window]);
+			}
+			else
+			{
+				memcpy(buckets + window * size, bases[i], base_lengths[i] * sizeof(uint32_t));
+				bucket_lengths[window] = base_lengths[i];
+				used[window] = TRUE;
+			}
+		}
+
+		// Product of bucket[j]^j computed with running products
+		running_used = total_used = FALSE;
+		for (j = entries - 1; j > 0 && status == SUCCESS; j--)
+		{
+			if (used[j] && running_used)
+			{
+				status = multiply_modulo(modulus, running, running, running_length, buckets + j * size, bucket_lengths[j], &running_length);
+			}
+			else if (used[j])
+			{
+				memcpy(running, buckets + j * size, bucket_lengths[j] * sizeof(uint32_t));
+				running_length = bucket_lengths[j];
+				running_used = TRUE;
+			}
+			if (running_used && total_used && status == SUCCESS)
+			{
+				status = multiply_modulo(modulus, total, total, total_length, running, running_length, &total_length);
+			}
+			else if (running_used)
+			{
+				memcpy(total, running, running_length * sizeof(uint32_t));
+				total_length = running_length;
+				total_used = TRUE;
+			}
+		}
+		if (total_used && status == SUCCESS)
+		{
+			status = multiply_modulo(modulus, result, result, *length, total, total_length, length);
+		}
+	}
+
+	free(buckets);
+	free(bucket_lengths);
+	free(used);
+	return status;
+}
+
+int bigint_powm_multi(bigint result, bigint *bases, bigint *exponents, size_t count, bigint modulus)
+{
+	// Wrong arguments passed to function
+	if (result == NULL || modulus == NULL || (count != 0 && (bases == NULL || exponents == NULL)))
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+	size_t i = 0;
+	for (i = 0; i < count; i++)
+	{
+		if (bases[i] == NULL || exponents[i] == NULL || exponents[i]->sign == NEGATIVE)
+		{
+			bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+			return FAILURE;
+		}
+	}
+
+	// Division by zero
+	if (modulus->length == 1 && modulus->first->value == 0)
+	{
+		bigint_errno = BIGINT_DIVISION_BY_ZERO;
+		return FAILURE;
+	}
+
+	struct bigint_modulus prepared;
+	if (prepare_modulus(&prepared, modulus) == FAILURE)
+	{
+		return FAILURE;
+	}
+
+	uint32_t **base_limbs = (uint32_t **)calloc(2 * count + 1, sizeof(uint32_t *));
+	size_t *lengths = (size_t *)malloc((2 * count + 1) * sizeof(size_t));
+	uint32_t *accumulator = (uint32_t *)malloc((prepared.length + 1) * sizeof(uint32_t));
+	if (base_limbs == NULL || lengths == NULL || accumulator == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(base_limbs);
+		free(lengths);
+		free(accumulator);
+		release_modulus(&prepared);
+		return FAILURE;
+	}
+	uint32_t **exponent_limbs = base_limbs + count;
+	size_t *exponent_lengths = lengths + count;
+
+	int status = SUCCESS;
+	size_t bits = 0, exponent_bits = 0;
+	for (i = 0; i < count && status == SUCCESS; i++)
+	{
+		base_limbs[i] = copy_residue(&prepared, bases[i], &lengths[i]);
+		exponent_limbs[i] = copy_to_limbs(exponents[i], &exponent_lengths[i]);
+		if (base_limbs[i] == NULL || exponent_limbs[i] == NULL)
+		{
+			bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+			status = FAILURE;
+			break;
+		}
+		exponent_lengths[i] = limbs_normalize(exponent_limbs[i], exponent_lengths[i]);
+		exponent_bits = (exponent_lengths[i] == 0 ? 0 : 32 * (exponent_lengths[i] - 1) + bit_len(exponent_limbs[i][exponent_lengths[i] - 1]));
+		bits = (exponent_bits > bits ? exponent_bits : bits);
+	}
+
+	// Start from 1; 1 mod 1 equals 0
+	size_t length = (prepared.length == 1 && prepared.limbs[0] == 1 ? 0 : 1);
+	accumulator[0] = 1;
+	if (status == SUCCESS && count < POWM_BUCKETS_THRESHOLD)
+	{
+		status = powm_straus(&prepared, accumulator, &length, base_limbs, lengths, exponent_limbs, exponent_lengths, count, bits);
+	}
+	else if (status == SUCCESS)
+	{
+		status = powm_buckets(&prepared, accumulator, &length, base_limbs, lengths, exponent_limbs, exponent_lengths, count, bits);
+	}
+	if (status == SUCCESS)
+	{
+		status = save_limbs(result, accumulator, length, POSITIVE);
+	}
+
+	for (i = 0; i < 2 * count; i++)
+	{
+		free(base_limbs[i]);
+	}
+	free(base_limbs);
+	free(lengths);
+	free(accumulator);
+	release_modulus(&prepared);
+	return status;
+}
+
+// Approximation of B^(2 * length) / limbs, B = 2^32, by Newton's iteration; result needs length + 2 limbs
+// Reciprocal of the top half gives X with relative error about B^(-length / 2) and one step
+// X + X * (B^(2 * length) - limbs * X) / B^(2 * length) doubles number of correct limbs
+int limbs_reciprocal(uint32_t *result, size_t *result_length, uint32_t *limbs, size_t length)
+{
+	if (length <= RECIPROCAL_THRESHOLD)
+	{
+		uint32_t *numerator = (uint32_t *)calloc(2 * length + 1, sizeof(uint32_t));
+		check_memory_int(numerator);
+		numerator[2 * length] = 1;
+		int status = limbs_divide(result, NULL, numerator, 2 * length + 1, limbs, length);
+		*result_length = limbs_normalize(result, length + 2);
+		free(numerator);
+		return status;
+	}
+
+	// Top part is a bit longer than half, so that errors do not pile up
+	size_t high = length / 2 + 2;
+	size_t low = length - high;
+	size_t high_length = 0;
+	if (limbs_reciprocal(result + low, &high_length, limbs + low, high) == FAILURE)
+	{
+		return FAILURE;
+	}
+	memset(result, 0, low * sizeof(uint32_t));
+	uint32_t *approximation = result + low;
+
+	// error = B^(length + high) - limbs * approximation
+	size_t size = length + high_length + 1;
+	if (size < length + high + 1)
+	{
+		size = length + high + 1;
+	}
+	uint32_t *block = (uint32_t *)calloc(2 * size + high_length, sizeof(uint32_t));
+	check_memory_int(block);
+	uint32_t *error = block, *correction = block + size;
+	uint8_t sign = POSITIVE;
+	if (limbs_multiply(error, limbs, length, approximation, high_length) == FAILURE)
+	{
+		free(block);
+		return FAILURE;
+	}
+	size_t error_length = limbs_normalize(error, length + high_length);
+	uint32_t one = 1;
+	if (error_length > length + high)
+	{
+		// Product is not smaller than B^(length + high)
+		limbs_subtract(error + length + high, error + length + high, error_length - length - high, &one, 1);
+		sign = NEGATIVE;
+	}
+	else
+	{
+		// correction buffer is still filled with zeros
+		limbs_subtract(error, correction, length + high, error, length + high);
+	}
+	error_length = limbs_normalize(error, size);
+
+	// correction = approximation * error / B^(2 * high)
+	if (limbs_multiply(correction, approximation, high_length, error, error_length) == FAILURE)
+	{
+		free(block);
+		return FAILURE;
+	}
+	size_t correction_length = limbs_normalize(correction, high_length + error_length);
+	if (correction_length > 2 * high)
+	{
+		if (sign == POSITIVE)
+		{
+			limbs_add(result, result, length + 2, correction + 2 * high, correction_length - 2 * high);
+		}
+		else
+		{
+			limbs_subtract(result, result, length + 2, correction + 2 * high, correction_length - 2 * high);
+		}
+	}
+	*result_length = limbs_normalize(result, length + 2);
+
+	free(block);
+	return SUCCESS;
+}
+
+// Division by limbs2 using its reciprocal computed by limbs_reciprocal(); limbs1 cannot be longer than 2 * length2 limbs
+// Quotient needs length1 + 3 limbs and remainder length2 limbs
+// Estimate limbs1 * reciprocal / B^(2 * length2) is very close to the quotient, the rest is fixed by long division
+int limbs_divide_reciprocal(uint32_t *quotient, size_t *quotient_length, uint32_t *remainder, size_t *remainder_length, uint32_t *limbs1, size_t length1, uint32_t *limbs2, size_t length2, uint32_t *reciprocal, size_t reciprocal_length)
+{
+	length1 = limbs_normalize(limbs1, length1);
+	if (length1 < length2)
+	{
+		memcpy(remainder, limbs1, length1 * sizeof(uint32_t));
+		*remainder_length = length1;
+		*quotient_length = 0;
+		return SUCCESS;
+	}
+
+	uint32_t *product = (uint32_t *)malloc((2 * length1 + reciprocal_length + length2 + 4) * sizeof(uint32_t));
+	check_memory_int(product);
+	uint32_t *temp = product + length1 + reciprocal_length;
+
+	// Estimate of quotient
+	size_t length = 0, temp_length = 0;
+	if (limbs_multiply(product, limbs1, length1, reciprocal, reciprocal_length) == FAILURE)
+	{
+		free(product);
+		return FAILURE;
+	}
+	length = (length1 + reciprocal_length > 2 * length2 ? length1 + reciprocal_length - 2 * length2 : 0);
+	memcpy(quotient, product + 2 * length2, length * sizeof(uint32_t));
+	length = limbs_normalize(quotient, length);
+
+	// temp = quotient * limbs2 is compared with limbs1
+	if (limbs_multiply(temp, quotient, length, limbs2, length2) == FAILURE)
+	{
+		free(product);
+		return FAILURE;
+	}
+	temp_length = limbs_normalize(temp, length + length2);
+
+	int status = SUCCESS;
+	uint32_t one = 1;
+	size_t extra_length = 0;
+	if (limbs_compare(temp, temp_length, limbs1, length1) <= 0)
+	{
+		// Estimate too small or exact: divide what is left
+		limbs_subtract(product, limbs1, length1, temp, temp_length);
+		temp_length = limbs_normalize(product, length1);
+		if (limbs_compare(product, temp_length, limbs2, length2) >= 0)
+		{
+			extra_length = temp_length - length2 + 1;
+			status = limbs_divide(temp, remainder, product, temp_length, limbs2, length2);
+			memset(quotient + length, 0, (extra_length + 1 > length ? extra_length + 1 - length : 1) * sizeof(uint32_t));
+			length = (length > extra_length ? length : extra_length);
+			quotient[length] = limbs_add(quotient, quotient, length, temp, extra_length);
+			length++;
+			*remainder_length = limbs_normalize(remainder, length2);
+		}
+		else
+		{
+			memcpy(remainder, product, temp_length * sizeof(uint32_t));
+			*remainder_length = temp_length;
+		}
+	}
+	else
+	{
+		// Estimate too large: limbs1 = (quotient - c - 1) * limbs2 + limbs2 - 1 - rest, where temp - limbs1 - 1 = c * limbs2 + rest
+		limbs_subtract(temp, temp, temp_length, limbs1, length1);
+		limbs_subtract(temp, temp, temp_length, &one, 1);
+		temp_length = limbs_normalize(temp, temp_length);
+		memset(product, 0, (temp_length + 2) * sizeof(uint32_t));
+		if (temp_length >= length2)
+		{
+			extra_length = temp_length - length2 + 1;
+			status = limbs_divide(product, remainder, temp, temp_length, limbs2, length2);
+		}
+		else
+		{
+			memset(remainder, 0, length2 * sizeof(uint32_t));
+			memcpy(remainder, temp, temp_length * sizeof(uint32_t));
+			extra_length = 1;
+		}
+		limbs_add(product, product, extra_length + 1, &one, 1);
+		limbs_subtract(quotient, quotient, length, product, limbs_normalize(product, extra_length + 1));
+		limbs_subtract(remainder, limbs2, length2, remainder, length2);
+		limbs_subtract(remainder, remainder, length2, &one, 1);
+		*remainder_length = limbs_normalize(remainder, length2);
+	}
+	*quotient_length = limbs_normalize(quotient, length);
+
+	free(product);
+	return status;
+}
+
+size_t varint_size(uint64_t value)
+{
+	size_t size = 1;
+	while (value >= 0x80)
+	{
+		value >>= 7;
+		size++;
+	}
+	return size;
+}
+
+// Seven bits in each byte starting from the least significant ones, highest bit means that more bytes follow
+size_t write_varint(uint8_t *buffer, uint64_t value)
+{
+	size_t i = 0;
+	while (value >= 0x80)
+	{
+		buffer[i++] = (uint8_t)(value | 0x80);
+		value >>= 7;
+	}
+	buffer[i++] = (uint8_t)value;
+	return i;
+}
+
+// Number of bytes read or 0 if varint is truncated or too long
+size_t read_varint(const uint8_t *buffer, size_t length, uint64_t *value)
+{
+	size_t i = 0;
+	*value = 0;
+	for (i = 0; i < length && i < 10; i++)
+	{
+		*value |= (uint64_t)(buffer[i] & 0x7f) << (7 * i);
+		if ((buffer[i] & 0x80) == 0)
+		{
+			return i + 1;
+		}
+	}
+	return 0;
+}
+
+void write_u64(uint8_t *buffer, uint64_t value)
+{
+	int i = 0;
+	for (i = 0; i < 8; i++)
+	{
+		buffer[i] = (uint8_t)(value >> (8 * i));
+	}
+}
+
+uint64_t read_u64(const uint8_t *buffer)
+{
+	uint64_t value = 0;
+	int i = 0;
+	for (i = 7; i >= 0; i--)
+	{
+		value = (value << 8) | buffer[i];
+	}
+	return value;
+}
+
+size_t bigint_serialized_size(bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (number == NULL || number->last == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	size_t length = bigint_export_count(number, 4);
+	return varint_size(((uint64_t)length << 1) | (length != 0 ? number->sign : 0)) + 4 * length;
+}
+
+size_t bigint_serialize(void *buffer, size_t capacity, bigint number)
+{
+
+	// Wrong arguments passed to function
+	if (buffer == NULL || number == NULL || number->last == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	if (bigint_serialized_size(number) > capacity)
+	{
+		bigint_errno = BIGINT_BUFFER_TOO_SMALL;
+		return 0;
+	}
+
+	// Number of limbs and sign in one varint followed by little endian limbs
+	size_t length = bigint_export_count(number, 4);
+	size_t position = write_varint((uint8_t *)buffer, ((uint64_t)length << 1) | (length != 0 ? number->sign : 0));
+	if (bigint_export((uint8_t *)buffer + position, &length, -1, 4, -1, number) == FAILURE)
+	{
+		return 0;
+	}
+
+	return position + 4 * length;
+}
+
+size_t bigint_deserialize(bigint result, const void *buffer, size_t length)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL || buffer == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return 0;
+	}
+
+	uint64_t header = 0;
+	size_t position = read_varint((const uint8_t *)buffer, length, &header);
+	uint64_t limbs_length = header >> 1;
+	if (position == 0 || limbs_length > (length - position) / 4 || (limbs_length == 0 && (header & 1) != 0))
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return 0;
+	}
+
+	if (bigint_import(result, (size_t)limbs_length, -1, 4, -1, (const uint8_t *)buffer + position) == FAILURE)
+	{
+		return 0;
+	}
+	result->sign = (result->length == 1 && result->first->value == 0 ? POSITIVE : (uint8_t)(header & 1));
+
+	return position + 4 * (size_t)limbs_length;
+}
+
+// Array: magic, version, count, count + 1 offsets of records from the beginning and records
+// Records are placed so that their limbs start at multiples of 4 bytes and can be read in place
+int bigint_write_array(FILE *stream, bigint *numbers, size_t count)
+{
+
+	// Wrong arguments passed to function
+	if (stream == NULL || (numbers == NULL && count != 0))
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t table_size = ARRAY_HEADER_SIZE + 8 * (count + 1);
+	uint8_t *table = (uint8_t *)malloc(table_size);
+	check_memory_int(table);
+	memset(table, 0, table_size);
+	memcpy(table, SERIALIZATION_MAGIC, 4);
+	table[4] = SERIALIZATION_VERSION;
+	write_u64(table + 8, count);
+
+	// Offsets of records; padding goes before each record
+	size_t i = 0, largest = 0, size = 0;
+	uint64_t position = table_size;
+	for (i = 0; i < count; i++)
+	{
+		size = bigint_serialized_size(numbers[i]);
+		if (size == 0)
+		{
+			free(table);
+			return FAILURE;
+		}
+		size_t header = size - 4 * bigint_export_count(numbers[i], 4);
+		position += (4 - (position + header) % 4) % 4;
+		write_u64(table + ARRAY_HEADER_SIZE + 8 * i, position);
+		position += size;
+		largest = (size > largest ? size : largest);
+	}
+	write_u64(table + ARRAY_HEADER_SIZE + 8 * count, position);
+
+	uint8_t *record = (uint8_t *)malloc(largest + 3);
+	if (record == NULL)
+	{
+		free(table);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return FAILURE;
+	}
+
+	int status = (fwrite(table, 1, table_size, stream) == table_size ? SUCCESS : FAILURE);
+	position = table_size;
+	for (i = 0; i < count && status == SUCCESS; i++)
+	{
+		size_t padding = (size_t)(read_u64(table + ARRAY_HEADER_SIZE + 8 * i) - position);
+		memset(record, 0, padding);
+		size = bigint_serialize(record + padding, largest, numbers[i]);
+		status = (size != 0 && fwrite(record, 1, padding + size, stream) == padding + size ? SUCCESS : FAILURE);
+		position += padding + size;
+	}
+
+	free(record);
+	free(table);
+	return status;
+}
+
+bigint *bigint_read_array(FILE *stream, size_t *count)
+{
+
+	// Wrong arguments passed to function
+	if (stream == NULL || count == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
+	}
+
+	uint8_t header[ARRAY_HEADER_SIZE];
+	if (fread(header, 1, ARRAY_HEADER_SIZE, stream) != ARRAY_HEADER_SIZE || memcmp(header, SERIALIZATION_MAGIC, 4) != 0 ||
+	    header[4] != SERIALIZATION_VERSION || read_u64(header + 8) > SIZE_MAX / 8 - 2)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return NULL;
+	}
+	*count = (size_t)read_u64(header + 8);
+
+	uint8_t *offsets = (uint8_t *)malloc(8 * (*count + 1));
+	check_memory_ptr(offsets);
+	bigint *numbers = (bigint *)malloc((*count != 0 ? *count : 1) * sizeof(bigint));
+	if (numbers == NULL || fread(offsets, 1, 8 * (*count + 1), stream) != 8 * (*count + 1))
+	{
+		free(offsets);
+		free(numbers);
+		bigint_errno = (numbers == NULL ? BIGINT_MEMORY_ALLOCATION_ERROR : BIGINT_INCORRECT_SERIALIZED_DATA);
+		return NULL;
+	}
+
+	// Records are read one after another into the same buffer
+	uint8_t *record = NULL;
+	size_t capacity = 0, i = 0;
+	uint64_t position = ARRAY_HEADER_SIZE + 8 * ((uint64_t)*count + 1);
+	int status = SUCCESS;
+	for (i = 0; i < *count && status == SUCCESS; i++)
+	{
+		uint64_t begin = read_u64(offsets + 8 * i), end = read_u64(offsets + 8 * (i + 1));
+		size_t size = (size_t)(end - position);
+		if (begin < position || end < begin)
+		{
+			bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+			status = FAILURE;
+			break;
+		}
+		if (size > capacity)
+		{
+			free(record);
+			capacity = size;
+			record = (uint8_t *)malloc(capacity);
+			if (record == NULL)
+			{
+				bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+				status = FAILURE;
+				break;
+			}
+		}
+		numbers[i] = bigint_create_empty_segments(1);
+		if (numbers[i] == NULL || fread(record, 1, size, stream) != size ||
+		    bigint_deserialize(numbers[i], record + (begin - position), (size_t)(end - begin)) == 0)
+		{
+			if (numbers[i] != NULL)
+			{
+				bigint_release_basic(numbers[i]);
+				bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+			}
+			status = FAILURE;
+			break;
+		}
+		position = end;
+	}
+
+	free(record);
+	free(offsets);
+	if (status == FAILURE)
+	{
+		while (i > 0)
+		{
+			bigint_release_basic(numbers[--i]);
+		}
+		free(numbers);
+		return NULL;
+	}
+	return numbers;
+}
+
+// Record of array kept in memory and its length; header and offsets are checked
+const uint8_t *array_record(const void *data, size_t size, size_t index, size_t *length)
+{
+	const uint8_t *bytes = (const uint8_t *)data;
+	if (data == NULL || size < ARRAY_HEADER_SIZE || memcmp(bytes, SERIALIZATION_MAGIC, 4) != 0 || bytes[4] != SERIALIZATION_VERSION)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return NULL;
+	}
+
+	// Offsets of the record and of the next one must lie in the buffer; index + 2 could overflow
+	uint64_t count = read_u64(bytes + 8);
+	if (index >= count || size < ARRAY_HEADER_SIZE + 16 || index > (size - ARRAY_HEADER_SIZE) / 8 - 2)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return NULL;
+	}
+
+	uint64_t begin = read_u64(bytes + ARRAY_HEADER_SIZE + 8 * index);
+	uint64_t end = read_u64(bytes + ARRAY_HEADER_SIZE + 8 * (index + 1));
+	if (begin > end || end > size)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return NULL;
+	}
+
+	*length = (size_t)(end - begin);
+	return bytes + begin;
+}
+
+size_t bigint_array_count(const void *data, size_t size)
+{
+	const uint8_t *bytes = (const uint8_t *)data;
+	if (data == NULL || size < ARRAY_HEADER_SIZE || memcmp(bytes, SERIALIZATION_MAGIC, 4) != 0 || bytes[4] != SERIALIZATION_VERSION)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return 0;
+	}
+
+	return (size_t)read_u64(bytes + 8);
+}
+
+int bigint_array_get(bigint result, const void *data, size_t size, size_t index)
+{
+
+	// Wrong arguments passed to function
+	if (result == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	size_t length = 0;
+	const uint8_t *record = array_record(data, size, index, &length);
+	if (record == NULL || bigint_deserialize(result, record, length) == 0)
+	{
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+const uint32_t *bigint_array_limbs(const void *data, size_t size, size_t index, size_t *length, int *sign)
+{
+
+	// Wrong arguments passed to function
+	if (length == NULL || sign == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
+	}
+
+	size_t record_length = 0;
+	uint64_t header = 0;
+	const uint8_t *record = array_record(data, size, index, &record_length);
+	if (record == NULL)
+	{
+		return NULL;
+	}
+	size_t position = read_varint(record, record_length, &header);
+	if (position == 0 || (header >> 1) > (record_length - position) / 4)
+	{
+		bigint_errno = BIGINT_INCORRECT_SERIALIZED_DATA;
+		return NULL;
+	}
+
+	*length = (size_t)(header >> 1);
+	*sign = (int)(header & 1);
+	return (const uint32_t *)(record + position);
+}
+
+bigint_parser bigint_parser_create(int radix)
+{
+
+	// Wrong arguments passed to function
+	if (radix < 2 || radix > MAX_RADIX)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
+	}
+
+	bigint_parser parser = (bigint_parser)malloc(sizeof(struct bigint_parser_state));
+	check_memory_ptr(parser);
+	memset(parser, 0, sizeof(struct bigint_parser_state));
+	parser->radix = radix;
+	parser->state = PARSER_START;
+	parser->sign = POSITIVE;
+
+	// Chunks of powers of two hold whole digits: 32 bits or 30 bits for bases 8 and 32
+	if ((radix & (radix - 1)) == 0)
+	{
+		parser->chunk_digits = 32 / (bit_len((uint32_t)radix) - 1);
+	}
+	else
+	{
+		radix_chunk_base(radix, &parser->chunk_digits);
+	}
+
+	return parser;
+}
+
+// Save complete chunk; the array grows twice when it is full
+int parser_push_chunk(bigint_parser parser)
+{
+	if (parser->count == parser->capacity)
+	{
+		size_t capacity = (parser->capacity == 0 ? 64 : 2 * parser->capacity);
+		uint32_t *chunks = (uint32_t *)realloc(parser->chunks, capacity * sizeof(uint32_t));
+		check_memory_int(chunks);
+		parser->chunks = chunks;
+		parser->capacity = capacity;
+	}
+
+	parser->chunks[parser->count++] = parser->current;
+	parser->current = 0;
+	parser->current_digits = 0;
+	return SUCCESS;
+}
+
+int bigint_parser_feed(bigint_parser parser, const char *chunk, size_t length)
+{
+
+	// Wrong arguments passed to function
+	if (parser == NULL || (chunk == NULL && length != 0))
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	// Whitespace may surround the number, sign may precede the digits
+	size_t i = 0;
+	uint32_t value = 0;
+	for (i = 0; i < length && parser->state != PARSER_ERROR; i++)
+	{
+		char c = chunk[i];
+		int space = (c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' || c == '\f');
+		if (parser->state == PARSER_START && !parser->signed_number && space)
+		{
+			continue;
+		}
+		if (parser->state == PARSER_START && !parser->signed_number && (c == '-' || c == '+'))
+		{
+			parser->sign = (c == '-' ? NEGATIVE : POSITIVE);
+			parser->signed_number = TRUE;
+			continue;
+		}
+		if (parser->state != PARSER_START && space)
+		{
+			parser->state = PARSER_END;
+			continue;
+		}
+
+		value = digit_value(c, parser->radix);
+		if (parser->state == PARSER_END || value >= (uint32_t)parser->radix)
+		{
+			parser->state = PARSER_ERROR;
+			break;
+		}
+		parser->state = PARSER_DIGITS;
+		parser->current = parser->current * (uint32_t)parser->radix + value;
+		if (++parser->current_digits == parser->chunk_digits && parser_push_chunk(parser) == FAILURE)
+		{
+			parser->state = PARSER_ERROR;
+			return FAILURE;
+		}
+	}
+
+	if (parser->state == PARSER_ERROR)
+	{
+		bigint_errno = BIGINT_INCORRECT_STRING;
+		return FAILURE;
+	}
+
+	return SUCCESS;
+}
+
+// Bits of chunks are joined starting from the incomplete chunk, which is the least significant one
+int parser_power_of_two(bigint_parser parser, bigint result)
+{
+	size_t bits = bit_len((uint32_t)parser->radix) - 1;
+	size_t chunk_bits = parser->chunk_digits * bits;
+	size_t length = (parser->count * chunk_bits + parser->current_digits * bits) / 32 + 2;
+	uint32_t *limbs = (uint32_t *)malloc(length * sizeof(uint32_t));
+	check_memory_int(limbs);
+
+	uint64_t accumulator = parser->current;
+	size_t filled = parser->current_digits * bits, i = 0, position = 0;
+	for (i = parser->count; i > 0; i--)
+	{
+		accumulator |= (uint64_t)parser->chunks[i - 1] << filled;
+		filled += chunk_bits;
+		if (filled >= 32)
+		{
+			limbs[position++] = (uint32_t)accumulator;
+			accumulator >>= 32;
+			filled -= 32;
+		}
+	}
+	while (filled > 0)
+	{
+		limbs[position++] = (uint32_t)accumulator;
+		accumulator >>= 32;
+		filled = (filled > 32 ? filled - 32 : 0);
+	}
+
+	int status = save_limbs(result, limbs, position, parser->sign);
+	free(limbs);
+	return status;
+}
+
+// Complete chunks are converted by halves, then the incomplete one is appended
+int parser_radix(bigint_parser parser, bigint result)
+{
+	uint32_t *limbs = (uint32_t *)malloc((parser->count + 3) * sizeof(uint32_t));
+	check_memory_int(limbs);
+
+	size_t length = 0;
+	if (chunks_to_limbs(parser->chunks, parser->count, parser->radix, limbs, &length, conversion_threads(parser->count)) == FAILURE)
+	{
+		free(limbs);
+		return FAILURE;
+	}
+
+	uint32_t multiplier = 1;
+	size_t i = 0;
+	for (i = 0; i < parser->current_digits; i++)
+	{
+		multiplier *= (uint32_t)parser->radix;
+	}
+	limbs[length] = limbs_multiply_1(limbs, limbs, length, multiplier);
+	length++;
+	limbs[length] = limbs_add(limbs, limbs, length, &parser->current, 1);
+	length++;
+
+	int status = save_limbs(result, limbs, limbs_normalize(limbs, length), parser->sign);
+	free(limbs);
+	return status;
+}
+
+int bigint_parser_finish(bigint_parser parser, bigint result)
+{
+
+	// Wrong arguments passed to function
+	if (parser == NULL || result == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		if (parser != NULL)
+		{
+			bigint_parser_release(parser);
+		}
+		return FAILURE;
+	}
+
+	// Number without any digits
+	if (parser->state == PARSER_START || parser->state == PARSER_ERROR)
+	{
+		bigint_errno = BIGINT_INCORRECT_STRING;
+		bigint_parser_release(parser);
+		return FAILURE;
+	}
+
+	int status = ((parser->radix & (parser->radix - 1)) == 0 ? parser_power_of_two(parser, result) : parser_radix(parser, result));
+	bigint_parser_release(parser);
+	return status;
+}
+
+int bigint_parser_release(bigint_parser parser)
+{
+
+	// Wrong arguments passed to function
+	if (parser == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	free(parser->chunks);
+	free(parser);
+	return SUCCESS;
+}
+
+bigint bigint_read(FILE *stream, int radix)
+{
+
+	// Wrong arguments passed to function
+	if (stream == NULL)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return NULL;
+	}
+
+	bigint_parser parser = bigint_parser_create(radix);
+	if (parser == NULL)
+	{
+		return NULL;
+	}
+	char *buffer = (char *)malloc(READ_BUFFER_SIZE);
+	if (buffer == NULL)
+	{
+		bigint_parser_release(parser);
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		return NULL;
+	}
+
+	// Stream is read to the end in pieces of constant size
+	size_t length = 0;
+	int status = SUCCESS;
+	while (status == SUCCESS && (length = fread(buffer, 1, READ_BUFFER_SIZE, stream)) > 0)
+	{
+		status = bigint_parser_feed(parser, buffer, length);
+	}
+	free(buffer);
+
+	bigint return_number = (status == SUCCESS ? bigint_create_empty_segments(1) : NULL);
+	if (return_number == NULL)
+	{
+		bigint_parser_release(parser);
+		return NULL;
+	}
+	if (bigint_parser_finish(parser, return_number) == FAILURE)
+	{
+		bigint_release_basic(return_number);
+		return NULL;
+	}
+
+	return return_number;
+}
+
+int bigint_set_threads(int count)
+{
+
+	// Wrong arguments passed to function
+	if (count < 0)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	store_int(&thread_count, count);
+	return SUCCESS;
+}
+
+int bigint_get_threads()
+{
+#if defined(POSIX_THREADS) || defined(WINDOWS_THREADS)
+	int count = load_int(&thread_count);
+	if (count != 0)
+	{
+		return count;
+	}
+
+	// By default there is one thread for every processor; the system is asked only once
+	count = load_int(&processor_count);
+	if (count != 0)
+	{
+		return count;
+	}
+#if defined(WINDOWS_THREADS)
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	count = (info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1);
+#elif defined(_SC_NPROCESSORS_ONLN)
+	long processors = sysconf(_SC_NPROCESSORS_ONLN);
+	count = (processors > 0 ? (int)processors : 1);
+#else
+	count = 1;
+#endif
+	store_int(&processor_count, count);
+	return count;
+#else
+	return 1;
+#endif
+}
+
+// Read integer shared by threads
+int load_int(int *value)
+{
+#if defined(BUILTIN_ATOMICS)
+	return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#elif defined(MSVC_ATOMICS)
+	return (int)_InterlockedCompareExchange((volatile long *)value, 0, 0);
+#else
+	return *value;
+#endif
+}
+
+// Write integer shared by threads
+void store_int(int *value, int desired)
+{
+#if defined(BUILTIN_ATOMICS)
+	__atomic_store_n(value, desired, __ATOMIC_RELEASE);
+#elif defined(MSVC_ATOMICS)
+	_InterlockedExchange((volatile long *)value, (long)desired);
+#else
+	*value = desired;
+#endif
+}
+
+// Replace integer shared by threads if it still has expected value; returns TRUE if it was replaced
+int exchange_int(int *value, int expected, int desired)
+{
+#if defined(BUILTIN_ATOMICS)
+	return (__atomic_compare_exchange_n(value, &expected, desired, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ? TRUE : FALSE);
+#elif defined(MSVC_ATOMICS)
+	return ((int)_InterlockedCompareExchange((volatile long *)value, (long)desired, (long)expected) == expected ? TRUE : FALSE);
+#else
+	if (*value != expected)
+	{
+		return FALSE;
+	}
+	*value = desired;
+	return TRUE;
+#endif
+}
+
+// Take one item from deque; the owner takes them from the front, other workers steal them from the back
+int queue_take(struct batch_queue *queue, int front, size_t *position)
+{
+	uint64_t range = 0, taken = 0;
+	uint32_t begin = 0, end = 0;
+	do
+	{
+#if defined(BUILTIN_ATOMICS)
+		range = __atomic_load_n(&queue->range, __ATOMIC_ACQUIRE);
+#elif defined(MSVC_ATOMICS)
+		range = (uint64_t)_InterlockedCompareExchange64((volatile __int64 *)&queue->range, 0, 0);
+#else
+		range = queue->range;
+#endif
+		begin = (uint32_t)(range >> 32);
+		end = (uint32_t)range;
+		if (begin >= end)
+		{
+			return FALSE;
+		}
+		taken = (front ? range + ((uint64_t)1 << 32) : range - 1);
+#if defined(BUILTIN_ATOMICS)
+	} while (!__atomic_compare_exchange_n(&queue->range, &range, taken, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+#elif defined(MSVC_ATOMICS)
+	} while ((uint64_t)_InterlockedCompareExchange64((volatile __int64 *)&queue->range, (__int64)taken, (__int64)range) != range);
+#else
+		queue->range = taken;
+	} while (0);
+#endif
+
+	*position = (front ? begin : end - 1);
+	return TRUE;
+}
+
+// Items are taken until all deques are empty or any item fails
+void batch_worker(struct batch_worker *worker)
+{
+	struct batch_work *work = worker->work;
+	size_t owner = 0, position = 0, i = 0;
+	int found = TRUE;
+	while (found && load_int(&work->failed) == FALSE)
+	{
+		owner = worker->id;
+		found = queue_take(&work->queues[owner], TRUE, &position);
+		for (i = 1; i < work->workers && !found; i++)
+		{
+			owner = (worker->id + i) % work->workers;
+			found = queue_take(&work->queues[owner], FALSE, &position);
+		}
+
+		// Items were dealt to deques in turn, so position in deque points to one item of sorted array
+		if (found && work->operation(work, work->items[work->start + owner + position * work->workers].index) == FAILURE &&
+		    exchange_int(&work->failed, FALSE, TRUE))
+		{
+			work->error = bigint_errno;
+		}
+	}
+}
+
+#if defined(POSIX_THREADS)
+void *batch_thread(void *worker)
+{
+	batch_worker((struct batch_worker *)worker);
+	return NULL;
+}
+#elif defined(WINDOWS_THREADS)
+DWORD WINAPI batch_thread(LPVOID worker)
+{
+	batch_worker((struct batch_worker *)worker);
+	return 0;
+}
+#endif
+
+// The most expensive items go first
+int compare_batch_items(const void *item1, const void *item2)
+{
+	double cost1 = ((const struct batch_item *)item1)->cost;
+	double cost2 = ((const struct batch_item *)item2)->cost;
+	return (cost1 < cost2) - (cost1 > cost2);
+}
+
+// Run operation for every item of batch; items are sorted by estimated cost and dealt to deques of workers in turn
+int batch_run(struct batch_work *work, size_t count, double (*cost)(struct batch_work *work, size_t index))
+{
+	if (count == 0)
+	{
+		return SUCCESS;
+	}
+
+	work->items = (struct batch_item *)malloc(count * sizeof(struct batch_item));
+	check_memory_int(work->items);
+	size_t i = 0;
+	double total = 0;
+	for (i = 0; i < count; i++)
+	{
+		work->items[i].index = i;
+		work->items[i].cost = cost(work, i);
+		total += work->items[i].cost;
+	}
+	qsort(work->items, count, sizeof(struct batch_item), compare_batch_items);
+
+	// Cheap batches are not worth starting threads
+	work->workers = (size_t)bigint_get_threads();
+	if (work->workers > count)
+	{
+		work->workers = count;
+	}
+	if (total < BATCH_PARALLEL_COST)
+	{
+		work->workers = 1;
+	}
+
+	struct batch_queue *queues = (struct batch_queue *)malloc(work->workers * sizeof(struct batch_queue));
+	struct batch_worker *workers = (struct batch_worker *)malloc(work->workers * sizeof(struct batch_worker));
+	if (queues == NULL || workers == NULL)
+	{
+		bigint_errno = BIGINT_MEMORY_ALLOCATION_ERROR;
+		free(work->items);
+		free(queues);
+		free(workers);
+		return FAILURE;
+	}
+	work->queues = queues;
+	work->failed = FALSE;
+
+	// Ends of deques have 32 bits, so very long batches are run in rounds
+	size_t round = 0, length = 0;
+	for (work->start = 0; work->start < count && work->failed == FALSE; work->start += round)
+	{
+		round = (count - work->start < BATCH_ROUND_SIZE ? count - work->start : BATCH_ROUND_SIZE);
+		for (i = 0; i < work->workers; i++)
+		{
+			length = (i < round ? (round - i - 1) / work->workers + 1 : 0);
+			queues[i].range = (uint64_t)length;
+			workers[i].work = work;
+			workers[i].id = i;
+			workers[i].started = FALSE;
+		}
+
+		// Worker that failed to start leaves its deque to be stolen by the others; the calling thread is worker 0
+		for (i = 1; i < work->workers; i++)
+		{
+#if defined(POSIX_THREADS)
+			workers[i].started = (pthread_create(&workers[i].thread, NULL, batch_thread, &workers[i]) == 0);
+#elif defined(WINDOWS_THREADS)
+			workers[i].thread = CreateThread(NULL, 0, batch_thread, &workers[i], 0, NULL);
+			workers[i].started = (workers[i].thread != NULL);
+#endif
+		}
+		batch_worker(&workers[0]);
+		for (i = 1; i < work->workers; i++)
+		{
+			if (workers[i].started)
+			{
+#if defined(POSIX_THREADS)
+				pthread_join(workers[i].thread, NULL);
+#elif defined(WINDOWS_THREADS)
+				WaitForSingleObject(workers[i].thread, INFINITE);
+				CloseHandle(workers[i].thread);
+#endif
+			}
+		}
+	}
+
+	free(work->items);
+	free(queues);
+	free(workers);
+
+	// Error of the first item that failed is reported in the calling thread
+	if (work->failed)
+	{
+		bigint_errno = work->error;
+		return FAILURE;
+	}
+	return SUCCESS;
+}
+
+// Every element of arrays passed to batch function must be created
+int check_batch(bigint *numbers, size_t count)
+{
+	size_t i = 0;
+	if (numbers == NULL && count != 0)
+	{
+		return FAILURE;
+	}
+	for (i = 0; i < count; i++)
+	{
+		if (numbers[i] == NULL)
+		{
+			return FAILURE;
+		}
+	}
+	return SUCCESS;
+}
+
+double cost_add(struct batch_work *work, size_t index)
+{
+	return (double)work->operands[0][index]->length + (double)work->operands[1][index]->length;
+}
+
+double cost_multiply(struct batch_work *work, size_t index)
+{
+	return (double)work->operands[0][index]->length * (double)work->operands[1][index]->length;
+}
+
+// Reduction costs about as much as multiplication of number by quotient
+double cost_mod(struct batch_work *work, size_t index)
+{
+	double length = (double)work->operands[0][index]->length;
+	double modulus_length = (double)work->operands[1][index]->length;
+	return (length > modulus_length ? (length - modulus_length + 1) * modulus_length : length);
+}
+
+// Every bit of exponent costs at least one squaring modulo modulus
+double cost_powm(struct batch_work *work, size_t index)
+{
+	double modulus_length = (double)work->operands[2][index]->length;
+	return 32 * (double)work->operands[1][index]->length * modulus_length * modulus_length;
+}
+
+int batch_add(struct batch_work *work, size_t index)
+{
+	return bigint_add(2, work->results[index], work->operands[0][index], work->operands[1][index]);
+}
+
+int batch_multiply(struct batch_work *work, size_t index)
+{
+	return bigint_mul(work->results[index], work->operands[0][index], work->operands[1][index]);
+}
+
+int batch_mod(struct batch_work *work, size_t index)
+{
+	return bigint_mod(work->results[index], work->operands[0][index], work->operands[1][index]);
+}
+
+int batch_powm(struct batch_work *work, size_t index)
+{
+	return bigint_powm(work->results[index], work->operands[0][index], work->operands[1][index], work->operands[2][index]);
+}
+
+int bigint_batch_add(bigint *results, bigint *numbers1, bigint *numbers2, size_t count)
+{
+
+	// Wrong arguments passed to function
+	if (check_batch(results, count) == FAILURE || check_batch(numbers1, count) == FAILURE || check_batch(numbers2, count) == FAILURE)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	struct batch_work work;
+	memset(&work, 0, sizeof(struct batch_work));
+	work.operation = batch_add;
+	work.results = results;
+	work.operands[0] = numbers1;
+	work.operands[1] = numbers2;
+	return batch_run(&work, count, cost_add);
+}
+
+int bigint_batch_mul(bigint *results, bigint *numbers1, bigint *numbers2, size_t count)
+{
+
+	// Wrong arguments passed to function
+	if (check_batch(results, count) == FAILURE || check_batch(numbers1, count) == FAILURE || check_batch(numbers2, count) == FAILURE)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	struct batch_work work;
+	memset(&work, 0, sizeof(struct batch_work));
+	work.operation = batch_multiply;
+	work.results = results;
+	work.operands[0] = numbers1;
+	work.operands[1] = numbers2;
+	return batch_run(&work, count, cost_multiply);
+}
+
+int bigint_batch_mod(bigint *results, bigint *numbers, bigint *moduli, size_t count)
+{
+
+	// Wrong arguments passed to function
+	if (check_batch(results, count) == FAILURE || check_batch(numbers, count) == FAILURE || check_batch(moduli, count) == FAILURE)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	struct batch_work work;
+	memset(&work, 0, sizeof(struct batch_work));
+	work.operation = batch_mod;
+	work.results = results;
+	work.operands[0] = numbers;
+	work.operands[1] = moduli;
+	return batch_run(&work, count, cost_mod);
+}
+
+int bigint_batch_powm(bigint *results, bigint *bases, bigint *exponents, bigint *moduli, size_t count)
+{
+
+	// Wrong arguments passed to function
+	if (check_batch(results, count) == FAILURE || check_batch(bases, count) == FAILURE ||
+	    check_batch(exponents, count) == FAILURE || check_batch(moduli, count) == FAILURE)
+	{
+		bigint_errno = BIGINT_INCORRECT_FUNCTION_ARGUMENT;
+		return FAILURE;
+	}
+
+	struct batch_work work;
+	memset(&work, 0, sizeof(struct batch_work));
+	work.operation = batch_powm;
+	work.results = results;
+	work.operands[0] = bases;
+	work.operands[1] = exponents;
+	work.operands[2] = moduli;
+	return batch_run(&work, count, cost_powm);
+}
+
+// Threads for conversion of number of given length; short numbers don't ask for the thread count at all
+int conversion_threads(size_t length)
+{
+	return (length >= PARALLEL_CONVERSION_THRESHOLD ? bigint_get_threads() : 1);
+}
+
+// Run task in another thread if parallel is TRUE and the thread can be started, otherwise run it now
+void task_start(struct conversion_task *task, int parallel)
+{
+	task->started = FALSE;
+#if defined(POSIX_THREADS)
+	task->started = (parallel && pthread_create(&task->thread, NULL, conversion_thread, task) == 0);
+#elif defined(WINDOWS_THREADS)
+	task->thread = (parallel ? CreateThread(NULL, 0, conversion_thread, task, 0, NULL) : NULL);
+	task->started = (task->thread != NULL);
+#else
+	(void)parallel;
+#endif
+	if (!task->started)
+	{
+		task->status = task->function(task);
+		task->error = bigint_errno;
+	}
+}
+
+// Wait for task; error of task that failed in another thread is reported in this one
+int task_finish(struct conversion_task *task)
+{
+	if (task->started)
+	{
+#if defined(POSIX_THREADS)
+		pthread_join(task->thread, NULL);
+#elif defined(WINDOWS_THREADS)
+		WaitForSingleObject(task->thread, INFINITE);
+		CloseHandle(task->thread);
+#endif
+	}
+	if (task->status == FAILURE)
+	{
+		bigint_errno = task->error;
+	}
+	return task->status;
+}
+
+#if defined(POSIX_THREADS)
+void *conversion_thread(void *task)
+{
+	struct conversion_task *current = (struct conversion_task *)task;
+	current->status = current->function(current);
+	current->error = bigint_errno;
+	return NULL;
+}
+#elif defined(WINDOWS_THREADS)
+DWORD WINAPI conversion_thread(LPVOID task)
+{
+	struct conversion_task *current = (struct conversion_task *)task;
+	current->status = current->function(current);
+	current->error = bigint_errno;
+	return 0;
+}
+#endif
+
+int task_chunks_to_limbs(struct conversion_task *task)
+{
+	return chunks_to_limbs(task->chunks, task->count, task->radix, task->limbs, &task->length, task->threads);
+}
+
+int task_limbs_to_radix(struct conversion_task *task)
+{
+	size_t written = 0;
+	return limbs_to_radix(task->limbs, task->length, task->radix, task->buffer, task->digits, &written, task->threads);
 }
@@ -11,11 +11,28 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define BIGINT_MAJOR 1
 #define BIGINT_MINOR 0
 #define BIGINT_PATCHLEVEL 0
 
-#define ERROR_MESSAGES_SIZE 8
+#define ERROR_MESSAGES_SIZE 12
+
+// Every thread has its own bigint_errno
+#if defined(__cplusplus) && __cplusplus >= 201103L
+#define BIGINT_THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define BIGINT_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__) || defined(__clang__)
+#define BIGINT_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define BIGINT_THREAD_LOCAL __declspec(thread)
+#else
+#define BIGINT_THREAD_LOCAL
+#endif
 #define bigint_strerror(A) (A >= 0 && A < ERROR_MESSAGES_SIZE ? error_messages[A] : "unknown error")
 
 struct bigint_node
@@ -33,6 +50,20 @@ struct bigint_data_structure
 	uint8_t sign;
 };
 
+struct bigint_parser_state
+{
+	int radix;
+	int state;
+	uint8_t sign;
+	uint8_t signed_number;
+	uint32_t *chunks;
+	size_t count;
+	size_t capacity;
+	uint32_t current;
+	size_t current_digits;
+	size_t chunk_digits;
+};
+
 enum bigint_error_code
 {
 	ALL_GOOD_IN_THE_HOOD,
@@ -42,7 +73,11 @@ enum bigint_error_code
 	BIGINT_TOO_LARGE_BIGINT_TO_CONVERT,
 	BIGINT_DIVISION_BY_ZERO,
 	BIGINT_LENGTH_INDIVISIBLE_BY_FOUR,
-	BIGINT_ERROR_IN_DATA_STRUCTURE
+	BIGINT_ERROR_IN_DATA_STRUCTURE,
+	BIGINT_NOT_INVERTIBLE,
+	BIGINT_BUFFER_TOO_SMALL,
+	BIGINT_INCORRECT_SERIALIZED_DATA,
+	BIGINT_WRITE_ERROR
 };
 
 enum bigint_base
@@ -57,30 +92,112 @@ typedef struct bigint_node bigint_node;
 typedef struct bigint_data_structure *bigint;
 typedef enum bigint_error_code bigint_error_code;
 typedef enum bigint_base bigint_base;
+typedef struct bigint_parser_state *bigint_parser;
+typedef int (*bigint_writer)(const char *data, size_t length, void *context);
 
-extern bigint_error_code bigint_errno;
-extern char *error_messages[ERROR_MESSAGES_SIZE];
+extern BIGINT_THREAD_LOCAL bigint_error_code bigint_errno;
+extern const char *const error_messages[ERROR_MESSAGES_SIZE];
 
 int bigint_info();
 bigint bigint_create(char *number, size_t length);
+bigint bigint_create_radix(char *number, size_t length, int radix);
 int bigint_release(int count, ...);
 size_t bigint_size(bigint number);
 int bigint_print(FILE *stream, bigint_base base, bigint number);
+size_t bigint_string_size(bigint number, bigint_base base);
+size_t bigint_to_string(char *buffer, size_t capacity, bigint_base base, bigint number);
+size_t bigint_string_size_radix(bigint number, int radix);
+size_t bigint_to_string_radix(char *buffer, size_t capacity, int radix, bigint number);
+int bigint_write(FILE *stream, int radix, bigint number);
+int bigint_write_callback(bigint_writer writer, void *context, int radix, bigint number);
 int bigint_add(int count, bigint sum, ...);
 int bigint_increment(bigint number);
 int bigint_subtract(bigint difference, bigint minuend, bigint subtrahend);
 int bigint_decrement(bigint number);
 int bigint_multiply(int count, bigint product, ...);
+int bigint_mul(bigint product, bigint number1, bigint number2);
+int bigint_addmul(bigint result, bigint number1, bigint number2);
+int bigint_submul(bigint result, bigint number1, bigint number2);
 int bigint_divide(bigint dividend, bigint divisor, bigint quotient, bigint remainder);
 int bigint_compare(bigint number1, bigint number2);
+int bigint_compare_status(int *result, bigint number1, bigint number2);
+int bigint_cmp_si(bigint number, long value);
+int bigint_cmp_ui(bigint number, unsigned long value);
+int bigint_cmpabs(bigint number1, bigint number2);
+int bigint_is_zero(bigint number);
+int bigint_is_one(bigint number);
+int bigint_sgn(bigint number);
 bigint bigint_convert_to_bigint(void *integer, size_t length);
 int bigint_convert_to_int(bigint number, uintmax_t *integer);
+bigint bigint_from_i64(int64_t value);
+bigint bigint_from_u64(uint64_t value);
+int bigint_set_i64(bigint number, int64_t value);
+int bigint_set_u64(bigint number, uint64_t value);
+int bigint_to_i64(bigint number, int64_t *value);
+int bigint_to_u64(bigint number, uint64_t *value);
+int bigint_fits_i64(bigint number);
+int bigint_fits_u64(bigint number);
+int bigint_import(bigint result, size_t count, int order, size_t size, int endian, const void *data);
+int bigint_export(void *data, size_t *count, int order, size_t size, int endian, bigint number);
+size_t bigint_export_count(bigint number, size_t size);
+size_t bigint_serialized_size(bigint number);
+size_t bigint_serialize(void *buffer, size_t capacity, bigint number);
+size_t bigint_deserialize(bigint result, const void *buffer, size_t length);
+int bigint_write_array(FILE *stream, bigint *numbers, size_t count);
+bigint *bigint_read_array(FILE *stream, size_t *count);
+size_t bigint_array_count(const void *data, size_t size);
+int bigint_array_get(bigint result, const void *data, size_t size, size_t index);
+const uint32_t *bigint_array_limbs(const void *data, size_t size, size_t index, size_t *length, int *sign);
+bigint_parser bigint_parser_create(int radix);
+int bigint_parser_feed(bigint_parser parser, const char *chunk, size_t length);
+int bigint_parser_finish(bigint_parser parser, bigint result);
+int bigint_parser_release(bigint_parser parser);
+bigint bigint_read(FILE *stream, int radix);
 int bigint_change_sign(bigint number);
 int bigint_absolute_value(bigint number);
 int bigint_get_sign(bigint number);
 int bigint_not(bigint number);
+int bigint_and(bigint result, bigint number1, bigint number2);
+int bigint_ior(bigint result, bigint number1, bigint number2);
+int bigint_xor(bigint result, bigint number1, bigint number2);
+int bigint_andnot(bigint result, bigint number1, bigint number2);
+size_t bigint_bit_length(bigint number);
+size_t bigint_popcount(bigint number);
+size_t bigint_hamdist(bigint number1, bigint number2);
+size_t bigint_scan0(bigint number, size_t start);
+size_t bigint_scan1(bigint number, size_t start);
+int bigint_tstbit(bigint number, size_t index);
+int bigint_setbit(bigint number, size_t index);
+int bigint_clrbit(bigint number, size_t index);
+int bigint_combit(bigint number, size_t index);
 int bigint_shift_left(bigint number, size_t count);
 int bigint_shift_right(bigint number, size_t count);
+int bigint_mul_2exp(bigint result, bigint number, size_t count);
+int bigint_tdiv_q_2exp(bigint result, bigint number, size_t count);
+int bigint_fdiv_r_2exp(bigint result, bigint number, size_t count);
 bigint bigint_copy(bigint number);
+int bigint_set(bigint result, bigint number);
+int bigint_fac_ui(bigint result, unsigned long n);
+int bigint_bin_uiui(bigint result, unsigned long n, unsigned long k);
+int bigint_primorial_ui(bigint result, unsigned long n);
+int bigint_fib_ui(bigint result, unsigned long n);
+int bigint_lucnum_ui(bigint result, unsigned long n);
+int bigint_divexact(bigint quotient, bigint dividend, bigint divisor);
+int bigint_mod(bigint result, bigint number, bigint modulus);
+int bigint_mulmod(bigint result, bigint number1, bigint number2, bigint modulus);
+int bigint_powm(bigint result, bigint base, bigint exponent, bigint modulus);
+int bigint_powm_multi(bigint result, bigint *bases, bigint *exponents, size_t count, bigint modulus);
+int bigint_invert(bigint result, bigint number, bigint modulus);
+int bigint_invert_batch(bigint *results, bigint *numbers, size_t count, bigint modulus);
+int bigint_set_threads(int count);
+int bigint_get_threads();
+int bigint_batch_add(bigint *results, bigint *numbers1, bigint *numbers2, size_t count);
+int bigint_batch_mul(bigint *results, bigint *numbers1, bigint *numbers2, size_t count);
+int bigint_batch_mod(bigint *results, bigint *numbers, bigint *moduli, size_t count);
+int bigint_batch_powm(bigint *results, bigint *bases, bigint *exponents, bigint *moduli, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif //_BIGINT_H
@@ -0,0 +1,630 @@
+/*
+ * Copyright (c) 2022 Krzysztof Karczewski
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef _BIGINT_HPP
+#define _BIGINT_HPP
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include "bigint.h"
+
+// std::formatter is available since C++20
+#if defined(__has_include)
+#if __has_include(<version>)
+#include <version>
+#endif
+#endif
+#if defined(__cpp_lib_format)
+#include <format>
+#endif
+
+namespace bigint_cpp
+{
+
+// Exception thrown when function of the library fails; code is the value of bigint_errno
+class error : public std::runtime_error
+{
+public:
+	explicit error(bigint_error_code code) : std::runtime_error(bigint_strerror(code)), error_code(code) {}
+	bigint_error_code code() const noexcept { return error_code; }
+
+private:
+	bigint_error_code error_code;
+};
+
+namespace detail
+{
+
+// Failure of allocation is reported as std::bad_alloc, all other failures as bigint_cpp::error
+inline void raise()
+{
+	if (bigint_errno == BIGINT_MEMORY_ALLOCATION_ERROR)
+	{
+		throw std::bad_alloc();
+	}
+	throw error(bigint_errno);
+}
+
+inline void check(int status)
+{
+	if (status == -1)
+	{
+		raise();
+	}
+}
+
+inline bigint check(bigint handle)
+{
+	if (handle == NULL)
+	{
+		raise();
+	}
+	return handle;
+}
+
+}
+
+class integer;
+
+// Products are not computed until they are assigned, added to or reduced, so that the result is written directly to its destination
+// Expressions keep references to their operands; they must be used in the same statement and never stored in auto variables
+struct product_expression
+{
+	const integer &factor1;
+	const integer &factor2;
+};
+
+// addend + factor1 * factor2 or addend - factor1 * factor2; the whole value is negated for factor1 * factor2 - addend
+struct addmul_expression
+{
+	const integer &factor1;
+	const integer &factor2;
+	const integer &addend;
+	bool subtract;
+	bool negate;
+};
+
+// factor1 * factor2 % modulus
+struct mulmod_expression
+{
+	const integer &factor1;
+	const integer &factor2;
+	const integer &modulus;
+};
+
+// Owner of one bigint variable; the variable is released together with the object
+// Moved-from object holds no variable and may only be assigned to or destroyed
+class integer
+{
+public:
+	integer() : handle(detail::check(bigint_from_u64(0))) {}
+
+	template <class T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+	integer(T value) : handle(detail::check(bigint_from_i64(static_cast<int64_t>(value)))) {}
+
+	template <class T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value, int>::type = 0>
+	integer(T value) : handle(detail::check(bigint_from_u64(static_cast<uint64_t>(value)))) {}
+
+	// String is written as for bigint_create_radix(), so it has no 0x or 0b prefix
+	explicit integer(const std::string &text, int radix = 10) : handle(parse(text.data(), text.size(), radix)) {}
+	explicit integer(const char *text, int radix = 10) : handle(parse(text, std::char_traits<char>::length(text), radix)) {}
+
+	integer(const integer &other) : handle(detail::check(bigint_copy(other.handle))) {}
+	integer(integer &&other) noexcept : handle(other.handle) { other.handle = NULL; }
+
+	integer(const product_expression &expression) : integer() { *this = expression; }
+	integer(const addmul_expression &expression) : integer() { *this = expression; }
+	integer(const mulmod_expression &expression) : integer() { *this = expression; }
+
+	~integer()
+	{
+		if (handle != NULL)
+		{
+			bigint_release(1, handle);
+		}
+	}
+
+	integer &operator=(const integer &other)
+	{
+		if (this != &other)
+		{
+			integer copy(other);
+			swap(copy);
+		}
+		return *this;
+	}
+
+	integer &operator=(integer &&other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	// Product is saved in segments that the object already has
+	integer &operator=(const product_expression &expression)
+	{
+		detail::check(bigint_mul(handle, expression.factor1.handle, expression.factor2.handle));
+		return *this;
+	}
+
+	// Addend is copied to the destination and the product is added to it in place (bigint_addmul() or bigint_submul())
+	integer &operator=(const addmul_expression &expression)
+	{
+		if (this == &expression.factor1 || this == &expression.factor2)
+		{
+			integer result(expression);
+			swap(result);
+			return *this;
+		}
+		if (this != &expression.addend)
+		{
+			detail::check(bigint_set(handle, expression.addend.handle));
+		}
+		if (expression.subtract)
+		{
+			detail::check(bigint_submul(handle, expression.factor1.handle, expression.factor2.handle));
+		}
+		else
+		{
+			detail::check(bigint_addmul(handle, expression.factor1.handle, expression.factor2.handle));
+		}
+		if (expression.negate)
+		{
+			detail::check(bigint_change_sign(handle));
+		}
+		return *this;
+	}
+
+	// bigint_mulmod() gives residue that is never negative; remainder of negative product has the sign of product like operator %
+	integer &operator=(const mulmod_expression &expression)
+	{
+		if (this == &expression.modulus)
+		{
+			integer result(expression);
+			swap(result);
+			return *this;
+		}
+		bool negative = expression.factor1.sign() * expression.factor2.sign() < 0;
+		detail::check(bigint_mulmod(handle, expression.factor1.handle, expression.factor2.handle, expression.modulus.handle));
+		if (negative && bigint_is_zero(handle) == 0)
+		{
+			if (expression.modulus.sign() > 0)
+			{
+				detail::check(bigint_subtract(handle, handle, expression.modulus.handle));
+			}
+			else
+			{
+				detail::check(bigint_add(2, handle, handle, expression.modulus.handle));
+			}
+		}
+		return *this;
+	}
+
+	integer &operator+=(const product_expression &expression)
+	{
+		detail::check(bigint_addmul(handle, expression.factor1.handle, expression.factor2.handle));
+		return *this;
+	}
+
+	integer &operator-=(const product_expression &expression)
+	{
+		detail::check(bigint_submul(handle, expression.factor1.handle, expression.factor2.handle));
+		return *this;
+	}
+
+	// Take ownership of variable created by the C functions
+	static integer adopt(bigint handle)
+	{
+		integer number(nullptr, 0);
+		number.handle = detail::check(handle);
+		return number;
+	}
+
+	// Variable passed to the C functions; it stays owned by the object
+	bigint get() const noexcept { return handle; }
+
+	// Give up ownership; the caller has to pass the variable to bigint_release()
+	bigint release() noexcept
+	{
+		bigint released = handle;
+		handle = NULL;
+		return released;
+	}
+
+	void swap(integer &other) noexcept { std::swap(handle, other.handle); }
+
+	std::string to_string(int radix = 10) const
+	{
+		size_t size = bigint_string_size_radix(handle, radix);
+		if (size == 0)
+		{
+			detail::raise();
+		}
+		std::string text(size, '\0');
+		size_t written = bigint_to_string_radix(&text[0], size, radix, handle);
+		if (written == 0)
+		{
+			detail::raise();
+		}
+		text.resize(written);
+		return text;
+	}
+
+	int64_t to_i64() const
+	{
+		int64_t value = 0;
+		detail::check(bigint_to_i64(handle, &value));
+		return value;
+	}
+
+	uint64_t to_u64() const
+	{
+		uint64_t value = 0;
+		detail::check(bigint_to_u64(handle, &value));
+		return value;
+	}
+
+	bool fits_i64() const noexcept { return bigint_fits_i64(handle) == 1; }
+	bool fits_u64() const noexcept { return bigint_fits_u64(handle) == 1; }
+	int sign() const noexcept { return bigint_sgn(handle); }
+	size_t bit_length() const noexcept { return bigint_bit_length(handle); }
+	bool test_bit(size_t index) const noexcept { return bigint_tstbit(handle, index) == 1; }
+	explicit operator bool() const noexcept { return bigint_is_zero(handle) == 0; }
+
+	integer &operator+=(const integer &other)
+	{
+		detail::check(bigint_add(2, handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator-=(const integer &other)
+	{
+		detail::check(bigint_subtract(handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator*=(const integer &other)
+	{
+		detail::check(bigint_mul(handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator/=(const integer &other) { return *this = divide(*this, other, true); }
+	integer &operator%=(const integer &other) { return *this = divide(*this, other, false); }
+
+	integer &operator&=(const integer &other)
+	{
+		detail::check(bigint_and(handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator|=(const integer &other)
+	{
+		detail::check(bigint_ior(handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator^=(const integer &other)
+	{
+		detail::check(bigint_xor(handle, handle, other.handle));
+		return *this;
+	}
+
+	integer &operator<<=(size_t count)
+	{
+		detail::check(bigint_mul_2exp(handle, handle, count));
+		return *this;
+	}
+
+	// Shift rounds down like shift of built-in integers
+	integer &operator>>=(size_t count)
+	{
+		bool inexact = sign() < 0 && bigint_scan1(handle, 0) < count;
+		detail::check(bigint_tdiv_q_2exp(handle, handle, count));
+		if (inexact)
+		{
+			detail::check(bigint_decrement(handle));
+		}
+		return *this;
+	}
+
+	integer &operator++()
+	{
+		detail::check(bigint_increment(handle));
+		return *this;
+	}
+
+	integer &operator--()
+	{
+		detail::check(bigint_decrement(handle));
+		return *this;
+	}
+
+	integer operator++(int)
+	{
+		integer previous(*this);
+		++*this;
+		return previous;
+	}
+
+	integer operator--(int)
+	{
+		integer previous(*this);
+		--*this;
+		return previous;
+	}
+
+	// Quotient is rounded towards zero and remainder has the sign of dividend, like for built-in integers
+	static integer divide(const integer &dividend, const integer &divisor, bool quotient)
+	{
+		integer result;
+		detail::check(bigint_divide(dividend.handle, divisor.handle, quotient ? result.handle : NULL, quotient ? NULL : result.handle));
+		return result;
+	}
+
+	friend int compare(const integer &number1, const integer &number2)
+	{
+		int result = 0;
+		detail::check(bigint_compare_status(&result, number1.handle, number2.handle));
+		return result;
+	}
+
+private:
+	bigint handle;
+
+	// Empty object used by adopt()
+	integer(std::nullptr_t, int) noexcept : handle(NULL) {}
+
+	static bigint parse(const char *text, size_t length, int radix)
+	{
+		return detail::check(bigint_create_radix(const_cast<char *>(text), length, radix));
+	}
+};
+
+inline integer operator+(const integer &number)
+{
+	return number;
+}
+
+inline integer operator-(integer number)
+{
+	detail::check(bigint_change_sign(number.get()));
+	return number;
+}
+
+// Complement of two's complement, that is -number - 1
+inline integer operator~(integer number)
+{
+	detail::check(bigint_change_sign(number.get()));
+	return std::move(--number);
+}
+
+// Temporaries passed as the first operand are reused for the result
+inline integer operator+(integer number1, const integer &number2) { return std::move(number1 += number2); }
+inline integer operator-(integer number1, const integer &number2) { return std::move(number1 -= number2); }
+inline integer operator/(const integer &number1, const integer &number2) { return integer::divide(number1, number2, true); }
+inline integer operator%(const integer &number1, const integer &number2) { return integer::divide(number1, number2, false); }
+inline integer operator&(integer number1, const integer &number2) { return std::move(number1 &= number2); }
+inline integer operator|(integer number1, const integer &number2) { return std::move(number1 |= number2); }
+inline integer operator^(integer number1, const integer &number2) { return std::move(number1 ^= number2); }
+inline integer operator<<(integer number, size_t count) { return std::move(number <<= count); }
+inline integer operator>>(integer number, size_t count) { return std::move(number >>= count); }
+
+// Product and the expressions fused with it: a * b + c, c - a * b, a * b % m
+inline product_expression operator*(const integer &number1, const integer &number2) { return product_expression{number1, number2}; }
+inline addmul_expression operator+(const product_expression &product, const integer &number) { return addmul_expression{product.factor1, product.factor2, number, false, false}; }
+inline addmul_expression operator+(const integer &number, const product_expression &product) { return addmul_expression{product.factor1, product.factor2, number, false, false}; }
+inline addmul_expression operator-(const integer &number, const product_expression &product) { return addmul_expression{product.factor1, product.factor2, number, true, false}; }
+inline addmul_expression operator-(const product_expression &product, const integer &number) { return addmul_expression{product.factor1, product.factor2, number, true, true}; }
+inline mulmod_expression operator%(const product_expression &product, const integer &modulus) { return mulmod_expression{product.factor1, product.factor2, modulus}; }
+
+inline integer operator+(const product_expression &product1, const product_expression &product2)
+{
+	integer result(product1);
+	return std::move(result += product2);
+}
+
+inline integer operator-(const product_expression &product1, const product_expression &product2)
+{
+	integer result(product1);
+	return std::move(result -= product2);
+}
+
+inline bool operator==(const integer &number1, const integer &number2) { return compare(number1, number2) == 0; }
+inline bool operator!=(const integer &number1, const integer &number2) { return compare(number1, number2) != 0; }
+inline bool operator<(const integer &number1, const integer &number2) { return compare(number1, number2) < 0; }
+inline bool operator<=(const integer &number1, const integer &number2) { return compare(number1, number2) <= 0; }
+inline bool operator>(const integer &number1, const integer &number2) { return compare(number1, number2) > 0; }
+inline bool operator>=(const integer &number1, const integer &number2) { return compare(number1, number2) >= 0; }
+
+inline void swap(integer &number1, integer &number2) noexcept
+{
+	number1.swap(number2);
+}
+
+inline integer abs(integer number)
+{
+	detail::check(bigint_absolute_value(number.get()));
+	return number;
+}
+
+// Residue that is never negative
+inline integer mod(const integer &number, const integer &modulus)
+{
+	integer result;
+	detail::check(bigint_mod(result.get(), number.get(), modulus.get()));
+	return result;
+}
+
+inline integer powm(const integer &base, const integer &exponent, const integer &modulus)
+{
+	integer result;
+	detail::check(bigint_powm(result.get(), base.get(), exponent.get(), modulus.get()));
+	return result;
+}
+
+inline integer invert(const integer &number, const integer &modulus)
+{
+	integer result;
+	detail::check(bigint_invert(result.get(), number.get(), modulus.get()));
+	return result;
+}
+
+namespace detail
+{
+
+// Base and letters of stream with flags set by std::hex, std::oct, std::uppercase and std::showpos
+inline std::string stream_string(const integer &number, std::ios_base::fmtflags flags)
+{
+	std::ios_base::fmtflags basefield = flags & std::ios_base::basefield;
+	std::string text = number.to_string(basefield == std::ios_base::hex ? 16 : (basefield == std::ios_base::oct ? 8 : 10));
+	if (flags & std::ios_base::uppercase)
+	{
+		for (size_t i = 0; i < text.size(); i++)
+		{
+			text[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(text[i])));
+		}
+	}
+	if ((flags & std::ios_base::showpos) && number.sign() >= 0)
+	{
+		text.insert(text.begin(), '+');
+	}
+	return text;
+}
+
+}
+
+inline std::ostream &operator<<(std::ostream &stream, const integer &number)
+{
+	return stream << detail::stream_string(number, stream.flags());
+}
+
+// Number is read as one word; failbit is set if it is not a correct number in base chosen by std::hex or std::oct
+inline std::istream &operator>>(std::istream &stream, integer &number)
+{
+	std::string text;
+	if (stream >> text)
+	{
+		std::ios_base::fmtflags basefield = stream.flags() & std::ios_base::basefield;
+		int radix = (basefield == std::ios_base::hex ? 16 : (basefield == std::ios_base::oct ? 8 : 10));
+		bigint handle = bigint_create_radix(const_cast<char *>(text.data()), text.size(), radix);
+		if (handle == NULL)
+		{
+			stream.setstate(std::ios_base::failbit);
+		}
+		else
+		{
+			number = integer::adopt(handle);
+		}
+	}
+	return stream;
+}
+
+}
+
+namespace std
+{
+
+// Hash of sign and all segments
+template <>
+struct hash<bigint_cpp::integer>
+{
+	size_t operator()(const bigint_cpp::integer &number) const noexcept
+	{
+		bigint handle = number.get();
+		if (handle == NULL)
+		{
+			return 0;
+		}
+		uint64_t hash = 14695981039346656037ull ^ handle->sign;
+		const bigint_node *current = handle->first;
+		for (size_t i = 0; i < handle->length; i++)
+		{
+			hash = (hash ^ current->value) * 1099511628211ull;
+			current = current->next;
+		}
+		return static_cast<size_t>(hash ^ (hash >> 32));
+	}
+};
+
+}
+
+// Format types d, x, X, o and b choose base 10, 16, 8 and 2
+#if defined(__cpp_lib_format)
+namespace std
+{
+
+template <>
+struct formatter<bigint_cpp::integer, char>
+{
+	int radix = 10;
+	bool uppercase = false;
+
+	constexpr std::format_parse_context::iterator parse(std::format_parse_context &context)
+	{
+		std::format_parse_context::iterator current = context.begin();
+		if (current != context.end() && *current != '}')
+		{
+			switch (*current)
+			{
+			case 'd':
+				radix = 10;
+				break;
+			case 'x':
+				radix = 16;
+				break;
+			case 'X':
+				radix = 16;
+				uppercase = true;
+				break;
+			case 'o':
+				radix = 8;
+				break;
+			case 'b':
+				radix = 2;
+				break;
+			default:
+				throw std::format_error("incorrect format of bigint_cpp::integer");
+			}
+			++current;
+		}
+		if (current != context.end() && *current != '}')
+		{
+			throw std::format_error("incorrect format of bigint_cpp::integer");
+		}
+		return current;
+	}
+
+	template <class FormatContext>
+	typename FormatContext::iterator format(const bigint_cpp::integer &number, FormatContext &context) const
+	{
+		std::string text = number.to_string(radix);
+		if (uppercase)
+		{
+			for (size_t i = 0; i < text.size(); i++)
+			{
+				text[i] = static_cast<char>(std::toupper(static_cast<unsigned char>(text[i])));
+			}
+		}
+		return std::copy(text.begin(), text.end(), context.out());
+	}
+};
+
+}
+#endif
+
+#endif //_BIGINT_HPP